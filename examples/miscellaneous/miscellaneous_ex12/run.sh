@@ -0,0 +1,13 @@
+#!/bin/bash
+
+#set -x
+
+source $LIBMESH_DIR/examples/run_common.sh
+
+example_name=miscellaneous_ex12
+
+# Small problem sizes, so that "make check" runs quickly; pass larger
+# values of -n on the command line for meaningful timings.
+options="-n 8 -repeat 2"
+
+run_example "$example_name" "$options"
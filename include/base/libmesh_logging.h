@@ -52,11 +52,13 @@ extern PerfLog perflog;
 // Macros for performance logging.  This allows us
 // to add performance monitors to the code without
 // impacting performance when performance logging
-// is disabled.
+// is disabled.  Each call site registers its event
+// once, so the event names must be the same every
+// time it is reached, e.g. string literals.
 #ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
 
-#  define START_LOG(a,b)   { libMesh::perflog.push(a,b); }
-#  define STOP_LOG(a,b)    { libMesh::perflog.pop(a,b); }
+#  define START_LOG(a,b)   { static const libMesh::PerfLog::EventId libmesh_log_event = libMesh::perflog.register_event(a,b); libMesh::perflog.push(libmesh_log_event); }
+#  define STOP_LOG(a,b)    { static const libMesh::PerfLog::EventId libmesh_log_event = libMesh::perflog.register_event(a,b); libMesh::perflog.pop(libmesh_log_event); }
 #  define PALIBMESH_USE_LOG(a,b)   { libmesh_deprecated(); }
 #  define RESTART_LOG(a,b) { libmesh_deprecated(); }
 
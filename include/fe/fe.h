@@ -22,10 +22,13 @@
 
 // Local includes
 #include "libmesh/fe_base.h"
+#include "libmesh/fe_shape_cache.h"
 #include "libmesh/libmesh.h"
 
 // C++ includes
 #include <cstddef>
+#include <map>
+#include <utility>
 
 namespace libMesh
 {
@@ -33,6 +36,8 @@ namespace libMesh
 // forward declarations
 class DofConstraints;
 class DofMap;
+class FELagrangeKernel;
+class FETensorShapes;
 
 #ifdef LIBMESH_ENABLE_INFINITE_ELEMENTS
 
@@ -201,6 +206,53 @@ public:
                                         const unsigned int j,
                                         const Point& p);
 
+  /**
+   * Sets \p v[i][q] to the value of the \f$ i^{th} \f$ shape
+   * function at the point \p p[q], for every shape function and
+   * point at once.  Where the shape functions on \p elem are
+   * products of one-dimensional ones they are evaluated through an
+   * \p FETensorShapes object, and the most common Lagrange bases
+   * through an \p FELagrangeKernel; otherwise \p shape() is called
+   * for each of them.
+   *
+   * \p v should already hold one vector per shape function, as the
+   * \p phi of an \p FE object does; each is resized to the number
+   * of points.
+   *
+   * On a p-refined element, \p o should be the base order of the element.
+   */
+  static void all_shapes(const Elem* elem,
+                         const Order o,
+                         const std::vector<Point>& p,
+                         std::vector<std::vector<OutputShape> >& v);
+
+  /**
+   * Sets \p v[i][q] to the \f$ j^{th} \f$ derivative of the
+   * \f$ i^{th} \f$ shape function at the point \p p[q], for every
+   * shape function and point at once, like \p all_shapes().
+   *
+   * On a p-refined element, \p o should be the base order of the element.
+   */
+  static void all_shape_derivs(const Elem* elem,
+                               const Order o,
+                               const unsigned int j,
+                               const std::vector<Point>& p,
+                               std::vector<std::vector<OutputShape> >& v);
+
+  /**
+   * Sets \p v[i][q] to the second \f$ j^{th} \f$ derivative of the
+   * \f$ i^{th} \f$ shape function at the point \p p[q], for every
+   * shape function and point at once, like \p all_shapes().  The
+   * derivatives are numbered as in \p shape_second_deriv().
+   *
+   * On a p-refined element, \p o should be the base order of the element.
+   */
+  static void all_shape_second_derivs(const Elem* elem,
+                                      const Order o,
+                                      const unsigned int j,
+                                      const std::vector<Point>& p,
+                                      std::vector<std::vector<OutputShape> >& v);
+
   /**
    * Build the nodal soln from the element soln.
    * This is the solution that will be plotted.
@@ -455,6 +507,31 @@ protected:
   virtual void init_shape_functions(const std::vector<Point>& qp,
                                     const Elem* e);
 
+  /**
+   * Describes the shape functions on \p elem in \p shapes as
+   * products of one-dimensional ones, for \p all_shapes() and
+   * friends, and returns true, or returns false if they are not.
+   * Only the families and element types which can be handled that
+   * way specialize this.  The factors depend on the orientation of
+   * the element, but \p shapes reuses its storage from one element
+   * to the next.
+   *
+   * On a p-refined element, \p o should be the base order of the element.
+   */
+  static bool tensor_shapes(const Elem* elem,
+                            const Order o,
+                            FETensorShapes& shapes);
+
+  /**
+   * @returns the \p FELagrangeKernel which evaluates the shape
+   * functions on \p elem for \p all_shapes() and friends, or \p NULL
+   * if there is none.  Only \p LAGRANGE specializes this.
+   *
+   * On a p-refined element, \p o should be the base order of the element.
+   */
+  static const FELagrangeKernel* lagrange_kernel(const Elem* elem,
+                                                 const Order o);
+
 #ifdef LIBMESH_ENABLE_INFINITE_ELEMENTS
 
   /**
@@ -478,9 +555,112 @@ protected:
   ElemType last_side;
 
   unsigned int last_edge;
+
+  /**
+   * The quadrature points on a side of the reference element, and
+   * the points they map to on the reference element itself.
+   */
+  struct SideReferencePoints
+  {
+    std::vector<Point> side_points;
+    std::vector<Point> elem_points;
+
+    /**
+     * The shared tables at \p elem_points.
+     */
+    FEShapeCache::CachedTables tables;
+  };
+
+  /**
+   * The side quadrature points mapped onto the reference element by
+   * \p side_map(), for each element type, side and side p level seen
+   * by the side \p reinit().  Sides are always built with the same
+   * node ordering, so these only change if the quadrature points do.
+   */
+  std::map<std::pair<ElemType, std::pair<unsigned int, unsigned int> >,
+           SideReferencePoints> side_reference_points;
+
+  /**
+   * The shared tables at the quadrature rule points, for each element
+   * type and p level seen by the volume \p reinit().
+   */
+  std::map<std::pair<ElemType, unsigned int>,
+           FEShapeCache::CachedTables> volume_shape_tables;
+
+  /**
+   * While \p reinit() evaluates the shape functions at points whose
+   * tables are shared through the \p FEShapeCache, the tables
+   * remembered for those points; \p NULL otherwise.
+   */
+  FEShapeCache::CachedTables* current_tables;
+
+  /**
+   * The tables whose contents were last copied into the shape
+   * function and mapping arrays, and the \p calculate_* flags they
+   * were copied with, so that reinits which land on the same tables
+   * again don't copy them again.
+   */
+  FEShapeCache::CachedTables copied_tables;
+  unsigned int copied_shape_flags;
 };
 
 
+// template specialization prototypes, needed so that the generic
+// FE<Dim,T>::all_shapes() and friends use them
+
+template <>
+bool FE<1,HIERARCHIC>::tensor_shapes(const Elem* elem,
+                                     const Order o,
+                                     FETensorShapes& shapes);
+
+template <>
+bool FE<2,HIERARCHIC>::tensor_shapes(const Elem* elem,
+                                     const Order o,
+                                     FETensorShapes& shapes);
+
+template <>
+bool FE<3,HIERARCHIC>::tensor_shapes(const Elem* elem,
+                                     const Order o,
+                                     FETensorShapes& shapes);
+
+template <>
+bool FE<1,L2_HIERARCHIC>::tensor_shapes(const Elem* elem,
+                                        const Order o,
+                                        FETensorShapes& shapes);
+
+template <>
+bool FE<2,L2_HIERARCHIC>::tensor_shapes(const Elem* elem,
+                                        const Order o,
+                                        FETensorShapes& shapes);
+
+template <>
+bool FE<3,L2_HIERARCHIC>::tensor_shapes(const Elem* elem,
+                                        const Order o,
+                                        FETensorShapes& shapes);
+
+#ifdef LIBMESH_ENABLE_HIGHER_ORDER_SHAPES
+
+template <>
+bool FE<1,BERNSTEIN>::tensor_shapes(const Elem* elem,
+                                    const Order o,
+                                    FETensorShapes& shapes);
+
+template <>
+bool FE<2,BERNSTEIN>::tensor_shapes(const Elem* elem,
+                                    const Order o,
+                                    FETensorShapes& shapes);
+
+#endif // LIBMESH_ENABLE_HIGHER_ORDER_SHAPES
+
+template <>
+const FELagrangeKernel* FE<2,LAGRANGE>::lagrange_kernel(const Elem* elem,
+                                                        const Order o);
+
+template <>
+const FELagrangeKernel* FE<3,LAGRANGE>::lagrange_kernel(const Elem* elem,
+                                                        const Order o);
+
+
 
 /**
  * Clough-Tocher finite elements.  Still templated on the dimension,
@@ -1043,7 +1223,9 @@ inline
 FE<Dim,T>::FE (const FEType& fet) :
   FEGenericBase<typename FEOutputType<T>::type> (Dim,fet),
   last_side(INVALID_ELEM),
-  last_edge(libMesh::invalid_uint)
+  last_edge(libMesh::invalid_uint),
+  current_tables(NULL),
+  copied_shape_flags(0)
 {
   // Sanity check.  Make sure the
   // Family specified in the template instantiation
@@ -494,6 +494,13 @@ protected:
    */
   std::vector<std::vector<OutputShape> >   phi;
 
+  /**
+   * True if the last \p init_shape_functions() copied \p phi from
+   * the \p FEShapeCache.  The reference values are then the same on
+   * every element, so \p compute_shape_functions() leaves them alone.
+   */
+  bool phi_from_shape_cache;
+
   /**
    * Shape function derivative values.
    */
@@ -675,6 +682,7 @@ FEGenericBase<OutputType>::FEGenericBase(const unsigned int d,
   FEAbstract(d,fet),
   _fe_trans( FETransformationBase<OutputType>::build(fet) ),
   phi(),
+  phi_from_shape_cache(false),
   dphi(),
   curl_phi(),
   div_phi(),
@@ -0,0 +1,257 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2014 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FE_BATCH_H
+#define LIBMESH_FE_BATCH_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/auto_ptr.h"
+#include "libmesh/enum_elem_type.h"
+#include "libmesh/fe_type.h"
+#include "libmesh/point.h"
+#include "libmesh/vector_value.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class Elem;
+class QBase;
+template <typename OutputType> class FEGenericBase;
+typedef FEGenericBase<Real> FEBase;
+
+/**
+ * Finite element data for a batch of elements of the same type and
+ * p level, reinitialized together.
+ *
+ * An \p FE object stores the data of one element as arrays of
+ * \p Point and \p Gradient, one per quadrature point and shape
+ * function, so the mapping and the physical derivatives are computed
+ * one small 3x3 problem at a time.  Here every quantity is instead
+ * stored as one contiguous array per component, with the element
+ * index varying fastest, e.g. the x derivative of shape function
+ * \p i at quadrature point \p qp on the \p k th element of the batch
+ * is <tt>get_dphi(0)[(i*n_qp + qp)*n_elem + k]</tt>.  The mapping,
+ * the Jacobian inverses and the physical derivatives are then all
+ * computed by unit-stride SIMD loops over the elements of the batch.
+ *
+ * Assembly reads the batched data in place, through the accessors
+ * below; nothing is copied back into \p FE objects.
+ *
+ * Only families whose reference shape functions do not depend on the
+ * element (\p LAGRANGE, \p L2_LAGRANGE and \p MONOMIAL) are supported.
+ * The reference tables come from an internal \p FE object, so they
+ * are shared through the \p FEShapeCache.
+ */
+class FEBatch
+{
+public:
+
+  /**
+   * Constructor.  A quadrature rule must be attached before the
+   * first \p reinit().
+   */
+  FEBatch (const unsigned int dim,
+           const FEType& fe_type);
+
+  /**
+   * Destructor.
+   */
+  ~FEBatch ();
+
+  /**
+   * @returns true if elements of type \p fe_type can be batched.
+   */
+  static bool is_supported (const FEType& fe_type);
+
+  /**
+   * Provides the quadrature rule used on every element of a batch.
+   */
+  void attach_quadrature_rule (QBase* q);
+
+  /**
+   * Computes the quadrature points, \p JxW and shape function
+   * derivatives on every element of \p elems, which must all have
+   * the same type and p level.
+   */
+  void reinit (const std::vector<const Elem*>& elems);
+
+  /**
+   * @returns the elements of the last \p reinit().
+   */
+  const std::vector<const Elem*>& get_elems () const
+  { return _elems; }
+
+  /**
+   * @returns the number of elements in the batch.
+   */
+  unsigned int n_elem () const
+  { return _n_elem; }
+
+  /**
+   * @returns the number of quadrature points per element.
+   */
+  unsigned int n_quadrature_points () const
+  { return _n_qp; }
+
+  /**
+   * @returns the number of shape functions per element.
+   */
+  unsigned int n_shape_functions () const
+  { return _n_shapes; }
+
+  /**
+   * @returns the value of shape function \p i at quadrature point
+   * \p qp, which is the same on every element.
+   */
+  Real phi (const unsigned int i,
+            const unsigned int qp) const
+  { return _phi[i*_n_qp + qp]; }
+
+  /**
+   * @returns the physical gradient of shape function \p i at
+   * quadrature point \p qp of element \p k of the batch.
+   */
+  RealGradient dphi (const unsigned int k,
+                     const unsigned int i,
+                     const unsigned int qp) const;
+
+  /**
+   * @returns the quadrature weight times the Jacobian determinant at
+   * quadrature point \p qp of element \p k of the batch.
+   */
+  Real JxW (const unsigned int k,
+            const unsigned int qp) const
+  { return _JxW[qp*_n_elem + k]; }
+
+  /**
+   * @returns the physical location of quadrature point \p qp of
+   * element \p k of the batch.
+   */
+  Point xyz (const unsigned int k,
+             const unsigned int qp) const;
+
+  /**
+   * @returns the shape function values, indexed [i*n_qp + qp].
+   */
+  const std::vector<Real>& get_phi () const
+  { return _phi; }
+
+  /**
+   * @returns component \p c of the physical shape function gradients,
+   * indexed [(i*n_qp + qp)*n_elem + k].
+   */
+  const std::vector<Real>& get_dphi (const unsigned int c) const
+  { libmesh_assert_less(c, LIBMESH_DIM); return _dphi[c]; }
+
+  /**
+   * @returns \p JxW, indexed [qp*n_elem + k].
+   */
+  const std::vector<Real>& get_JxW () const
+  { return _JxW; }
+
+  /**
+   * @returns component \p c of the quadrature point locations,
+   * indexed [qp*n_elem + k].
+   */
+  const std::vector<Real>& get_xyz (const unsigned int c) const
+  { libmesh_assert_less(c, LIBMESH_DIM); return _xyz[c]; }
+
+private:
+
+  /**
+   * Copies the reference shape and mapping function tables for the
+   * type and p level of \p elem out of the internal \p FE object.
+   */
+  void init_reference_tables (const Elem& elem);
+
+  /**
+   * Computes \p _JxW and \p _inverse_jacobian from \p _jacobian.
+   */
+  void compute_inverse_jacobians ();
+
+  const unsigned int _dim;
+
+  const FEType _fe_type;
+
+  /**
+   * Evaluates the reference tables.
+   */
+  UniquePtr<FEBase> _fe;
+
+  QBase* _qrule;
+
+  /**
+   * The element type and p level the reference tables are for.
+   */
+  ElemType _elem_type;
+  unsigned int _p_level;
+
+  unsigned int _n_elem;
+  unsigned int _n_qp;
+  unsigned int _n_shapes;
+  unsigned int _n_map;
+
+  std::vector<const Elem*> _elems;
+
+  /**
+   * Reference shape functions and their xi/eta/zeta derivatives,
+   * indexed [i*n_qp + qp].
+   */
+  std::vector<Real> _phi;
+  std::vector<Real> _dphiref[3];
+
+  /**
+   * Reference mapping functions and their derivatives, indexed
+   * [n*n_qp + qp].
+   */
+  std::vector<Real> _map_phi;
+  std::vector<Real> _map_dphiref[3];
+
+  std::vector<Real> _weights;
+
+  /**
+   * Node coordinates, indexed [n*n_elem + k].
+   */
+  std::vector<Real> _nodes[LIBMESH_DIM];
+
+  /**
+   * Derivatives of the physical coordinates with respect to the
+   * reference coordinates, \p _jacobian[d][c] being d x_c / d xi_d,
+   * and of the reference coordinates with respect to the physical
+   * coordinates, \p _inverse_jacobian[d][c] being d xi_d / d x_c,
+   * both indexed [qp*n_elem + k].
+   */
+  std::vector<Real> _jacobian[3][LIBMESH_DIM];
+  std::vector<Real> _inverse_jacobian[3][LIBMESH_DIM];
+
+  std::vector<Real> _xyz[LIBMESH_DIM];
+
+  std::vector<Real> _JxW;
+
+  std::vector<Real> _dphi[LIBMESH_DIM];
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_FE_BATCH_H
@@ -280,6 +280,38 @@ public:
                     const Point& p,
                     OutputType& phi);
 
+  /**
+   * Sets \p v[i][q] to the value of the \f$ i^{th} \f$ shape
+   * function at the point \p p[q], for every shape function and
+   * point at once.  Automatically passes the request to the
+   * appropriate finite element class member; see
+   * \p FE<Dim,T>::all_shapes().  \p v should already hold one
+   * vector per shape function.
+   *
+   * On a p-refined element, \p fe_t.order should be the base order of the element.
+   */
+  template< typename OutputType>
+  static void all_shapes(const unsigned int dim,
+                         const FEType& fe_t,
+                         const Elem* elem,
+                         const std::vector<Point>& p,
+                         std::vector<std::vector<OutputType> >& v);
+
+  /**
+   * Sets \p v[i][q] to the \f$ j^{th} \f$ derivative of the
+   * \f$ i^{th} \f$ shape function at the point \p p[q], for every
+   * shape function and point at once, like \p all_shapes().
+   *
+   * On a p-refined element, \p fe_t.order should be the base order of the element.
+   */
+  template< typename OutputType>
+  static void all_shape_derivs(const unsigned int dim,
+                               const FEType& fe_t,
+                               const Elem* elem,
+                               const unsigned int j,
+                               const std::vector<Point>& p,
+                               std::vector<std::vector<OutputType> >& v);
+
   /**
    * Lets the appropriate child of \p FEBase compute the requested
    * data for the input specified in \p data, and returns the values
@@ -0,0 +1,109 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2014 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FE_LAGRANGE_KERNEL_H
+#define LIBMESH_FE_LAGRANGE_KERNEL_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/enum_elem_type.h"
+#include "libmesh/enum_order.h"
+#include "libmesh/point.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * Evaluates the first and second order \p LAGRANGE shape functions
+ * of the most common element types at many points at once: the
+ * linear basis on \p TRI3, \p TRI6, \p QUAD4, \p QUAD9, \p TET4,
+ * \p TET10, \p HEX8 and \p HEX27, and the quadratic basis on
+ * \p TRI6, \p QUAD9, \p TET10 and \p HEX27.
+ *
+ * \p FE<Dim,LAGRANGE>::shape() switches on the order, the element
+ * type and the shape function index for every shape function at
+ * every point.  Each kernel here is instead compiled for a single
+ * basis, with its number of shape functions and their formulas
+ * fixed at compile time, so the loops over shape functions unroll.
+ * A kernel is looked up once with \p select() and then fills whole
+ * tables of shape function values or derivatives.
+ */
+class FELagrangeKernel
+{
+public:
+
+  /**
+   * The function each kernel evaluates its shape functions with;
+   * see \p evaluate().
+   */
+  typedef void (*Evaluator) (const unsigned int deriv[3],
+                             const std::vector<Point>& p,
+                             std::vector<std::vector<Real> >& v);
+
+  /**
+   * Constructor.  Kernels are only built by \p select().
+   */
+  FELagrangeKernel (const unsigned int dim,
+                    const unsigned int n_shapes,
+                    const Evaluator evaluator);
+
+  /**
+   * @returns the kernel for the \p order Lagrange basis on \p type,
+   * or \p NULL if there is no specialized kernel for it.
+   */
+  static const FELagrangeKernel* select (const ElemType type,
+                                         const Order order);
+
+  /**
+   * @returns the dimension of the reference element.
+   */
+  unsigned int dim () const { return _dim; }
+
+  /**
+   * @returns the number of shape functions.
+   */
+  unsigned int n_shapes () const { return _n_shapes; }
+
+  /**
+   * Sets \p v[i][q] to the derivative of shape function \p i at
+   * \p p[q], differentiated \p deriv[a] times with respect to
+   * \f$ \xi_a \f$, for every shape function.  Only up to second
+   * derivatives are available.  \p v must hold \p n_shapes()
+   * vectors; each is resized to the number of points.
+   */
+  void evaluate (const unsigned int deriv[3],
+                 const std::vector<Point>& p,
+                 std::vector<std::vector<Real> >& v) const
+  { _evaluator(deriv, p, v); }
+
+private:
+
+  const unsigned int _dim;
+
+  const unsigned int _n_shapes;
+
+  const Evaluator _evaluator;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_FE_LAGRANGE_KERNEL_H
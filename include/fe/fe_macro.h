@@ -49,6 +49,9 @@
   template void         FE<2,SUBDIVISION>::attach_quadrature_rule (QBase*); \
   template unsigned int FE<2,SUBDIVISION>::n_quadrature_points () const; \
   template void         FE<2,SUBDIVISION>::reinit(const Elem*,const std::vector<Point>* const,const std::vector<Real>* const); \
+  template void         FE<2,SUBDIVISION>::all_shapes(const Elem*,const Order,const std::vector<Point>&,std::vector<std::vector<Real> >&); \
+  template void         FE<2,SUBDIVISION>::all_shape_derivs(const Elem*,const Order,const unsigned int,const std::vector<Point>&,std::vector<std::vector<Real> >&); \
+  template void         FE<2,SUBDIVISION>::all_shape_second_derivs(const Elem*,const Order,const unsigned int,const std::vector<Point>&,std::vector<std::vector<Real> >&); \
   template void         FE<2,SUBDIVISION>::init_base_shape_functions(const std::vector<Point>&, const Elem*); \
   template void         FE<2,SUBDIVISION>::init_shape_functions(const std::vector<Point>&, const Elem*)
 
@@ -59,6 +62,9 @@
   template void         FE<2,SUBDIVISION>::attach_quadrature_rule (QBase*); \
   template unsigned int FE<2,SUBDIVISION>::n_quadrature_points () const; \
   template void         FE<2,SUBDIVISION>::reinit(const Elem*,const std::vector<Point>* const,const std::vector<Real>* const); \
+  template void         FE<2,SUBDIVISION>::all_shapes(const Elem*,const Order,const std::vector<Point>&,std::vector<std::vector<Real> >&); \
+  template void         FE<2,SUBDIVISION>::all_shape_derivs(const Elem*,const Order,const unsigned int,const std::vector<Point>&,std::vector<std::vector<Real> >&); \
+  template void         FE<2,SUBDIVISION>::all_shape_second_derivs(const Elem*,const Order,const unsigned int,const std::vector<Point>&,std::vector<std::vector<Real> >&); \
   template void         FE<2,SUBDIVISION>::init_shape_functions(const std::vector<Point>&, const Elem*)
 
 #endif // LIBMESH_ENABLE_INFINITE_ELEMENTS
@@ -443,6 +443,39 @@ protected:
    */
   void resize_quadrature_map_vectors(const unsigned int dim, unsigned int n_qp);
 
+  /**
+   * Sums the element nodes times the mapping shape functions and
+   * their derivatives, giving \p xyz and the derivatives of the map
+   * at the points \p p_begin up to \p p_end.  Used by
+   * \p compute_single_point_map() and \p compute_map().
+   */
+  void compute_map_terms(const unsigned int dim,
+                         const unsigned int p_begin,
+                         const unsigned int p_end,
+                         const std::vector<Node*>& elem_nodes);
+
+  /**
+   * The sums of \p compute_map_terms() in \p Dim dimensions.  For
+   * the node counts of the common element types \p NNodes is fixed
+   * at compile time, so the loops over the nodes unroll; 0 sums
+   * over however many mapping shape functions there are.
+   */
+  template <unsigned int Dim, unsigned int NNodes>
+  void sum_map_terms(const unsigned int p_begin,
+                     const unsigned int p_end,
+                     const std::vector<Node*>& elem_nodes);
+
+  /**
+   * Computes the jacobian, \p JxW and the derivatives of the inverse
+   * map at the point with index p, from the derivatives of the map
+   * summed by \p compute_map_terms().
+   */
+  void compute_single_point_jacobian(const unsigned int dim,
+                                     const std::vector<Real>& qw,
+                                     const Elem* elem,
+                                     unsigned int p,
+                                     const std::vector<Node*>& elem_nodes);
+
   /**
    * Used in \p FEMap::compute_map(), which should be
    * be usable in derived classes, and therefore protected.
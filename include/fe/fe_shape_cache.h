@@ -0,0 +1,198 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2014 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FE_SHAPE_CACHE_H
+#define LIBMESH_FE_SHAPE_CACHE_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/enum_elem_type.h"
+#include "libmesh/fe_type.h"
+#include "libmesh/point.h"
+
+// C++ includes
+#include <cstddef>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * A process-wide store of reference shape function tables.  For
+ * scalar-valued families whose shape functions do not depend on the
+ * element geometry (i.e. \p shapes_need_reinit() is false) the values
+ * and reference derivatives at a given set of quadrature points are
+ * the same for every element of a given type and p level, so they
+ * only need to be evaluated once and can be shared by every \p FE
+ * object on every thread.
+ *
+ * Tables are never modified or removed once inserted (until
+ * \p clear() is called), so a pointer returned by \p find() or
+ * \p insert() can be read without holding any lock.  \p FE objects
+ * keep the pointers they have looked up, so the lock is only taken
+ * the first time an object needs a table.
+ *
+ * At most \p max_size() tables are kept; once the cache is full,
+ * \p insert() declines further tables, which their callers then
+ * keep to themselves.
+ */
+class FEShapeCache
+{
+public:
+
+  /**
+   * Shape function values and reference derivatives, indexed
+   * [i][qp] like the corresponding \p FEGenericBase arrays, along
+   * with what they were evaluated for.
+   */
+  struct Table
+  {
+    /**
+     * Returns true if this table holds the shape functions of
+     * \p fe_type on elements of type \p elem_type at p level
+     * \p p_level, evaluated at the reference points \p qp.
+     */
+    bool matches (const FEType& fe_type_in,
+                  const ElemType elem_type_in,
+                  const unsigned int p_level_in,
+                  const bool second_derivatives_in,
+                  const std::vector<Point>& qp_in) const
+    {
+      return fe_type == fe_type_in && elem_type == elem_type_in &&
+        p_level == p_level_in && second_derivatives == second_derivatives_in &&
+        qp == qp_in;
+    }
+
+    FEType fe_type;
+    ElemType elem_type;
+    unsigned int p_level;
+    bool second_derivatives;
+    std::vector<Point> qp;
+
+    /**
+     * Shape function values.
+     */
+    std::vector<std::vector<Real> > phi;
+
+    /**
+     * First derivatives with respect to xi, eta and zeta.
+     */
+    std::vector<std::vector<Real> > dphiref[3];
+
+#ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
+    /**
+     * Second derivatives, numbered as in \p shape_second_deriv():
+     * xi-xi, xi-eta, eta-eta, xi-zeta, eta-zeta, zeta-zeta.  Only
+     * filled in tables built with second derivatives.
+     */
+    std::vector<std::vector<Real> > d2phiref[6];
+#endif
+  };
+
+  /**
+   * The shape and mapping tables an \p FE object last used at one
+   * set of points.  Holding on to these lets repeated reinits at the
+   * same points skip the lookup, and the lock, entirely.
+   */
+  struct CachedTables
+  {
+    CachedTables () :
+      shapes(NULL),
+      map(NULL),
+      generation(FEShapeCache::generation())
+    {}
+
+    /**
+     * Forgets the tables if the cache has been cleared since they
+     * were looked up.
+     */
+    void revalidate ()
+    {
+      if (generation != FEShapeCache::generation())
+        {
+          shapes = NULL;
+          map = NULL;
+          generation = FEShapeCache::generation();
+        }
+    }
+
+    const Table* shapes;
+    const Table* map;
+    unsigned int generation;
+  };
+
+  /**
+   * Returns the table for \p fe_type on elements of type
+   * \p elem_type at p level \p p_level, evaluated at the reference
+   * points \p qp, or \p NULL if none has been inserted yet.
+   */
+  static const Table* find (const FEType& fe_type,
+                            const ElemType elem_type,
+                            const unsigned int p_level,
+                            const bool second_derivatives,
+                            const std::vector<Point>& qp);
+
+  /**
+   * Stores \p table for the given key and returns the cached copy.
+   * If another thread inserted the same table first, that one is
+   * returned and \p table is left unchanged; otherwise its contents
+   * are swapped into the cache.  If the cache is full, returns
+   * \p NULL and leaves \p table unchanged.
+   */
+  static const Table* insert (const FEType& fe_type,
+                              const ElemType elem_type,
+                              const unsigned int p_level,
+                              const bool second_derivatives,
+                              const std::vector<Point>& qp,
+                              Table& table);
+
+  /**
+   * Frees all cached tables, invalidating any pointer previously
+   * returned by \p find() or \p insert(), and increments
+   * \p generation() so that \p FE objects drop the pointers they
+   * hold.  Must not be called while other threads reinitialize
+   * \p FE objects.
+   */
+  static void clear ();
+
+  /**
+   * Returns the number of times \p clear() has been called.
+   */
+  static unsigned int generation ();
+
+  /**
+   * Returns the number of cached tables.
+   */
+  static std::size_t size ();
+
+  /**
+   * Returns the maximum number of cached tables.
+   */
+  static std::size_t max_size ();
+
+  /**
+   * Sets the maximum number of cached tables.  Tables already cached
+   * are kept even if there are more of them.
+   */
+  static void set_max_size (const std::size_t n);
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_FE_SHAPE_CACHE_H
@@ -0,0 +1,242 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2014 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FE_TENSOR_PRODUCT_H
+#define LIBMESH_FE_TENSOR_PRODUCT_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/enum_elem_type.h"
+#include "libmesh/fe_type.h"
+#include "libmesh/point.h"
+#include "libmesh/vector_value.h"
+
+// C++ includes
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class Elem;
+template <typename T> class DenseVectorBase;
+
+/**
+ * Sum factorization evaluation of tensor-product finite elements.
+ *
+ * On EDGE2/3, QUAD4/9 and HEX8/27 elements the \p LAGRANGE,
+ * \p HIERARCHIC and \p L2_HIERARCHIC bases are (up to signs and
+ * ordering) products of one-dimensional bases, and the Gauss rules
+ * are products of one-dimensional rules.  Interpolating a solution
+ * to the quadrature points or integrating a residual against the
+ * shape functions can then be done one direction at a time, in
+ * \f$ O(p^{d+1}) \f$ operations per element instead of the
+ * \f$ O(p^{2d}) \f$ it takes with the full \p phi and \p dphi tables
+ * of an \p FE object, which this class never builds.  The element
+ * geometry is computed the same way, so nothing here is
+ * proportional to the size of a full shape function table.
+ *
+ * This is intended for matrix-free residual evaluation with
+ * high-order elements; see \p FEMContext::get_element_tensor_fe().
+ */
+class FETensorProduct
+{
+public:
+
+  /**
+   * Constructor.  Quadrature uses the Gauss rule of order \p qorder
+   * (raised with the element p level as \p QGauss does), so on a
+   * given element the quadrature points are the same as those of
+   * a \p QGauss(dim, qorder) rule, in the same order.
+   */
+  FETensorProduct (const unsigned int dim,
+                   const FEType& fe_type,
+                   const Order qorder);
+
+  /**
+   * @returns true if the family of \p fe_type has a tensor-product
+   * basis on the elements supported here.
+   */
+  static bool is_supported (const FEType& fe_type);
+
+  /**
+   * @returns true if \p elem can be handled by this object.
+   */
+  bool supports (const Elem& elem) const;
+
+  /**
+   * Computes the quadrature points, \p JxW and inverse Jacobians on
+   * \p elem.
+   */
+  void reinit (const Elem* elem);
+
+  /**
+   * Forgets the current element, e.g. because its nodes have moved.
+   */
+  void clear ()
+  { _elem = NULL; }
+
+  /**
+   * @returns the element of the last \p reinit(), or \p NULL.
+   */
+  const Elem* get_elem () const
+  { return _elem; }
+
+  /**
+   * @returns the number of shape functions on the current element.
+   */
+  unsigned int n_dofs () const;
+
+  /**
+   * @returns the number of quadrature points on the current element.
+   */
+  unsigned int n_quadrature_points () const
+  { return cast_int<unsigned int>(_JxW.size()); }
+
+  /**
+   * @returns the physical locations of the quadrature points.
+   */
+  const std::vector<Point>& get_xyz () const
+  { return _xyz; }
+
+  /**
+   * @returns the quadrature weights times the Jacobian determinant.
+   */
+  const std::vector<Real>& get_JxW () const
+  { return _JxW; }
+
+  /**
+   * Evaluates the field with element coefficients \p coefs at the
+   * quadrature points.
+   */
+  void interpolate (const DenseVectorBase<Number>& coefs,
+                    std::vector<Number>& values) const;
+
+  /**
+   * Evaluates the field with element coefficients \p coefs and its
+   * physical gradient at the quadrature points.
+   */
+  void interpolate (const DenseVectorBase<Number>& coefs,
+                    std::vector<Number>& values,
+                    std::vector<Gradient>& gradients) const;
+
+  /**
+   * Adds \f$ \sum_{qp} JxW_{qp} (f_{qp} \phi_i(qp) + g_{qp} \cdot
+   * \nabla \phi_i(qp)) \f$ to entry \p i of \p residual, for every
+   * shape function.  Either of \p f or \p g may be empty.
+   */
+  void integrate (const std::vector<Number>& f,
+                  const std::vector<Gradient>& g,
+                  DenseVectorBase<Number>& residual) const;
+
+private:
+
+  /**
+   * Where each shape function sits in the tensor-product basis:
+   * shape function \p i is \p sign[i] times the product of 1D
+   * functions whose (x fastest) flattened index is \p index[i].
+   */
+  struct DofOrdering
+  {
+    std::vector<unsigned int> index;
+    std::vector<Real> sign;
+  };
+
+  /**
+   * Everything that depends only on the element type and p level.
+   * 1D tables are stored [qp][i], row major.
+   */
+  struct Tables
+  {
+    unsigned int n_1d;
+    unsigned int n_qp_1d;
+    std::vector<Real> phi, dphi, phi_t, dphi_t;
+
+    unsigned int n_map_1d;
+    std::vector<Real> map_phi, map_dphi;
+    std::vector<unsigned int> node_index;
+
+    std::vector<Real> weights;
+
+    /**
+     * Orderings for each distinct orientation of the element, keyed
+     * by the vertex comparisons the shape functions depend on.
+     */
+    std::map<unsigned int, DofOrdering> orderings;
+  };
+
+  /**
+   * Computes (or looks up) the tables for the type and p level of
+   * \p elem.
+   */
+  Tables& tables_for (const Elem& elem);
+
+  /**
+   * Computes (or looks up) the ordering of the shape functions on
+   * \p elem.
+   */
+  const DofOrdering& ordering_for (const Elem& elem, Tables& tables);
+
+  /**
+   * Shared implementation of the \p interpolate() methods; skips
+   * the gradients if \p gradients is \p NULL.
+   */
+  void evaluate (const DenseVectorBase<Number>& coefs,
+                 std::vector<Number>& values,
+                 std::vector<Gradient>* gradients) const;
+
+  const unsigned int _dim;
+
+  const FEType _fe_type;
+
+  const Order _qorder;
+
+  const Elem* _elem;
+
+  std::map<std::pair<ElemType, unsigned int>, Tables> _tables;
+
+  const Tables* _current_tables;
+
+  const DofOrdering* _current_ordering;
+
+  std::vector<Point> _xyz;
+
+  std::vector<Real> _JxW;
+
+  /**
+   * The derivatives of the reference coordinates with respect to
+   * the physical coordinates, \p _dim rows of \p LIBMESH_DIM entries
+   * per quadrature point.
+   */
+  std::vector<Real> _inverse_jacobian;
+
+  /**
+   * Scratch space for the contractions, kept between elements so it
+   * need not be reallocated.
+   */
+  std::vector<Real> _map_scratch[LIBMESH_DIM+3];
+  std::vector<Real> _dxyzdxi[LIBMESH_DIM][LIBMESH_DIM];
+  mutable std::vector<Number> _scratch[LIBMESH_DIM+3];
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_FE_TENSOR_PRODUCT_H
@@ -0,0 +1,136 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2014 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FE_TENSOR_SHAPES_H
+#define LIBMESH_FE_TENSOR_SHAPES_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/enum_fe_family.h"
+#include "libmesh/enum_order.h"
+#include "libmesh/point.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * Evaluates every shape function of a tensor-product basis at every
+ * point at once.
+ *
+ * On quadrilaterals and hexahedra each \p HIERARCHIC,
+ * \p L2_HIERARCHIC and \p BERNSTEIN shape function is a signed
+ * product of one-dimensional shape functions of the reference
+ * coordinates, some of which may be reflected or swapped to match
+ * the orientation of the element's edges and faces.  Once the
+ * family has described its shape functions that way with
+ * \p set_shape(), \p evaluate() builds the one-dimensional tables
+ * at each point with recurrences, in \f$ O(p) \f$ operations per
+ * direction, and multiplies them out.  Evaluating each shape
+ * function separately repeats the powers and factorials, and
+ * the element orientation logic, for every shape function and point.
+ */
+class FETensorShapes
+{
+public:
+
+  /**
+   * Constructor.  \p reinit() must be called before the object is
+   * used.
+   */
+  FETensorShapes ();
+
+  /**
+   * Constructor.  The shape functions are built from the one
+   * dimensional \p family basis of order \p order, which must be
+   * \p HIERARCHIC, \p L2_HIERARCHIC or \p BERNSTEIN.
+   */
+  FETensorShapes (const unsigned int dim,
+                  const FEFamily family,
+                  const Order order,
+                  const unsigned int n_shapes);
+
+  /**
+   * Starts describing \p n_shapes shape functions of the \p family
+   * basis of order \p order, as in the constructor.  Every shape
+   * function must be declared again with \p set_shape(), but the
+   * storage is only reallocated when it grows.
+   */
+  void reinit (const unsigned int dim,
+               const FEFamily family,
+               const Order order,
+               const unsigned int n_shapes);
+
+  /**
+   * Declares shape function \p i to be \p sign times the product,
+   * over \p c from 0 to \p dim-1, of one-dimensional shape function
+   * \p index[c] evaluated at coordinate \p coordinate[c].  That is
+   * \p a+1 for the reference coordinate \f$ \xi_a \f$, or
+   * \p -(a+1) for \f$ -\xi_a \f$.
+   */
+  void set_shape (const unsigned int i,
+                  const unsigned int index[],
+                  const int coordinate[],
+                  const Real sign = 1.);
+
+  /**
+   * Sets \p v[i][q] to the derivative of shape function \p i at
+   * \p p[q], differentiated \p deriv[a] times with respect to
+   * \f$ \xi_a \f$, for every shape function.  Only up to second
+   * derivatives are available.
+   */
+  void evaluate (const unsigned int deriv[3],
+                 const std::vector<Point>& p,
+                 std::vector<std::vector<Real> >& v) const;
+
+  /**
+   * Sets \p values[k] to the \p n th derivative at \p x of the
+   * one-dimensional shape function \p k of \p family and \p order,
+   * numbered as in \p FE<1,family>::shape(), for every \p k up to
+   * \p order.  \p n may be 0, 1 or 2.
+   */
+  static void shapes_1D (const FEFamily family,
+                         const Order order,
+                         const unsigned int n,
+                         const Real x,
+                         Real* values);
+
+private:
+
+  unsigned int _dim;
+
+  FEFamily _family;
+
+  Order _order;
+
+  /**
+   * The one-dimensional factors of each shape function, \p _dim
+   * entries per shape function.
+   */
+  std::vector<unsigned int> _index;
+  std::vector<int> _coordinate;
+
+  std::vector<Real> _sign;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_FE_TENSOR_SHAPES_H
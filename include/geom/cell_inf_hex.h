@@ -117,7 +117,7 @@ public:
    * The id is not necessariy unique, but should be close.  This is
    * particularly useful in the \p MeshBase::find_neighbors() routine.
    */
-  dof_id_type key (const unsigned int s) const;
+  uint64_t key (const unsigned int s) const;
 
   /**
    * @returns a primitive (4-noded) quad or infquad for
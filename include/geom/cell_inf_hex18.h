@@ -152,7 +152,7 @@ public:
    * use the center node of the bottom face to provide a perfect (unique)
    * key.
    */
-  dof_id_type key (const unsigned int s) const;
+  uint64_t key (const unsigned int s) const;
 
   virtual void connectivity(const unsigned int sc,
                             const IOPackage iop,
@@ -116,7 +116,7 @@ public:
    * The id is not necessariy unique, but should be close.  This is
    * particularly useful in the \p MeshBase::find_neighbors() routine.
    */
-  dof_id_type key (const unsigned int s) const;
+  uint64_t key (const unsigned int s) const;
 
   /**
    * @returns a primitive (3-noded) tri or (4-noded) infquad for
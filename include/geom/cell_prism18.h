@@ -141,7 +141,7 @@ public:
    * use the center node of each quad face to provide a perfect (unique)
    * key.
    */
-  dof_id_type key (const unsigned int s) const;
+  uint64_t key (const unsigned int s) const;
 
   /**
    * Builds a \p QUAD9 or \p TRI6 built coincident with face i.
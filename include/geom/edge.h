@@ -125,7 +125,7 @@ public:
    * The id is not necessariy unique, but should be close.  This is
    * particularly useful in the \p MeshBase::find_neighbors() routine.
    */
-  dof_id_type key (const unsigned int s) const
+  uint64_t key (const unsigned int s) const
   { return this->compute_key(this->node(s)); }
 
   /**
@@ -201,8 +201,10 @@ public:
    * @returns an id associated with the \p s side of this element.
    * The id is not necessariy unique, but should be close.  This is
    * particularly useful in the \p MeshBase::find_neighbors() routine.
+   * The key is 64 bits wide regardless of the size of \p dof_id_type,
+   * so that collisions stay rare on meshes with billions of sides.
    */
-  virtual dof_id_type key (const unsigned int s) const = 0;
+  virtual uint64_t key (const unsigned int s) const = 0;
 
   /**
    * @returns true if two elements are identical, false otherwise.
@@ -1172,6 +1174,23 @@ public:
   static UniquePtr<Elem> build (const ElemType type,
                                 Elem* p=NULL);
 
+  /**
+   * Elements are allocated from slabs of memory shared by all
+   * elements of the same size, rather than one at a time from the
+   * heap.  Memory freed by deleting an element is recycled for the
+   * next element of that size.
+   */
+  static void * operator new (std::size_t size);
+
+  static void operator delete (void * ptr, std::size_t size);
+
+  /**
+   * Returns the memory slabs of every element size with no live
+   * elements left back to the system.  Returns true if any memory
+   * was freed.
+   */
+  static bool release_pool_memory ();
+
 #ifdef LIBMESH_ENABLE_AMR
 
   /**
@@ -1229,28 +1248,28 @@ protected:
   /**
    * Compute a key from the specified nodes.
    */
-  static dof_id_type compute_key (dof_id_type n0);
+  static uint64_t compute_key (dof_id_type n0);
 
   /**
    * Compute a key from the specified nodes.
    */
-  static dof_id_type compute_key (dof_id_type n0,
-                                  dof_id_type n1);
+  static uint64_t compute_key (dof_id_type n0,
+                               dof_id_type n1);
 
   /**
    * Compute a key from the specified nodes.
    */
-  static dof_id_type compute_key (dof_id_type n0,
-                                  dof_id_type n1,
-                                  dof_id_type n2);
+  static uint64_t compute_key (dof_id_type n0,
+                               dof_id_type n1,
+                               dof_id_type n2);
 
   /**
    * Compute a key from the specified nodes.
    */
-  static dof_id_type compute_key (dof_id_type n0,
-                                  dof_id_type n1,
-                                  dof_id_type n2,
-                                  dof_id_type n3);
+  static uint64_t compute_key (dof_id_type n0,
+                               dof_id_type n1,
+                               dof_id_type n2,
+                               dof_id_type n3);
 
 
 #ifdef LIBMESH_ENABLE_AMR
@@ -2035,7 +2054,7 @@ void Elem::hack_p_level(unsigned int p)
 
 
 inline
-dof_id_type Elem::compute_key (dof_id_type n0)
+uint64_t Elem::compute_key (dof_id_type n0)
 {
   return n0;
 }
@@ -2043,21 +2062,22 @@ dof_id_type Elem::compute_key (dof_id_type n0)
 
 
 inline
-dof_id_type Elem::compute_key (dof_id_type n0,
-                               dof_id_type n1)
+uint64_t Elem::compute_key (dof_id_type n0,
+                            dof_id_type n1)
 {
   // Order the two so that n0 < n1
   if (n0 > n1) std::swap (n0, n1);
 
-  return Utility::hashword2(n0, n1);
+  return Utility::hashword2(static_cast<uint64_t>(n0),
+                            static_cast<uint64_t>(n1));
 }
 
 
 
 inline
-dof_id_type Elem::compute_key (dof_id_type n0,
-                               dof_id_type n1,
-                               dof_id_type n2)
+uint64_t Elem::compute_key (dof_id_type n0,
+                            dof_id_type n1,
+                            dof_id_type n2)
 {
   // Order the numbers such that n0 < n1 < n2.
   // We'll do it in 3 steps like this:
@@ -2082,17 +2102,17 @@ dof_id_type Elem::compute_key (dof_id_type n0,
 
   libmesh_assert ((n0 < n1) && (n1 < n2));
 
-  dof_id_type array[3] = {n0, n1, n2};
+  uint64_t array[3] = {n0, n1, n2};
   return Utility::hashword(array, 3);
 }
 
 
 
 inline
-dof_id_type Elem::compute_key (dof_id_type n0,
-                               dof_id_type n1,
-                               dof_id_type n2,
-                               dof_id_type n3)
+uint64_t Elem::compute_key (dof_id_type n0,
+                            dof_id_type n1,
+                            dof_id_type n2,
+                            dof_id_type n3)
 {
   // Sort first
   // Step 1
@@ -2112,7 +2132,7 @@ dof_id_type Elem::compute_key (dof_id_type n0,
 
   libmesh_assert ((n0 < n1) && (n1 < n2) && (n2 < n3));
 
-  dof_id_type array[4] = {n0, n1, n2, n3};
+  uint64_t array[4] = {n0, n1, n2, n3};
   return Utility::hashword(array, 4);
 }
 
@@ -129,7 +129,7 @@ public:
    * use the center node of each edge to provide a perfect (unique)
    * key.
    */
-  dof_id_type key (const unsigned int s) const;
+  uint64_t key (const unsigned int s) const;
 
   UniquePtr<Elem> build_side (const unsigned int i,
                               bool proxy) const;
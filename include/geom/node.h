@@ -27,6 +27,7 @@
 #include "libmesh/auto_ptr.h"
 
 // C++ includes
+#include <cstddef>
 #include <iostream>
 #include <vector>
 
@@ -110,6 +111,22 @@ public:
                                 const Real z,
                                 const dof_id_type id);
 
+  /**
+   * Nodes are allocated from slabs of memory, rather than one at a
+   * time from the heap.  Memory freed by deleting a node is recycled
+   * for the next node.
+   */
+  static void * operator new (std::size_t size);
+
+  static void operator delete (void * ptr, std::size_t size);
+
+  /**
+   * Returns the memory slabs of the node pool back to the system, if
+   * there are no live nodes left.  Returns true if any memory was
+   * freed.
+   */
+  static bool release_pool_memory ();
+
   /**
    * @returns \p true if the node is active.  An active node is
    * defined as one for which \p id() is not \p Node::invalid_id.
@@ -98,7 +98,7 @@ public:
    * @returns an id associated with the \p s side of this element.
    * This should never be important for NodeElems
    */
-  dof_id_type key (const unsigned int) const
+  uint64_t key (const unsigned int) const
   { return 0; }
 
   /**
@@ -91,7 +91,7 @@ public:
   virtual Node* & set_node (const unsigned int i)
   { libmesh_not_implemented(); return Elem::set_node(i); }
 
-  virtual dof_id_type key (const unsigned int) const
+  virtual uint64_t key (const unsigned int) const
   { libmesh_not_implemented(); return 0; }
 
   virtual bool is_remote () const
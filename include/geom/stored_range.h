@@ -89,6 +89,25 @@ public:
     this->reset(first, last);
   }
 
+  /**
+   * Constructor.  Takes a vector of objects which is used directly,
+   * rather than copied, and so must outlive the range and any
+   * subranges split from it; such a range should not be \p reset()
+   * without arguments.  Optionally takes the \p grainsize
+   * parameter, which is the smallest chunk the range may be broken
+   * into for parallel execution.
+   */
+  explicit
+  StoredRange (const std::vector<object_type> &objs,
+               const unsigned int new_grainsize = 1000) :
+    _end(objs.end()),
+    _begin(objs.begin()),
+    _last(objs.size()),
+    _first(0),
+    _grainsize(new_grainsize),
+    _objs()
+  {}
+
   /**
    * Copy constructor.  The \p StoredRange can be copied into
    * subranges for parallel execution.  In this way the
@@ -0,0 +1,238 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2014 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+#ifndef LIBMESH_ASYNC_MESH_OUTPUT_H
+#define LIBMESH_ASYNC_MESH_OUTPUT_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <deque>
+#include <exception>
+#include <set>
+#include <string>
+
+namespace libMesh
+{
+// Forward declarations
+class EquationSystems;
+class ExodusII_IO;
+class Nemesis_IO;
+
+/**
+ * Performs time-series output on a background writer thread, so
+ * that the simulation is not blocked while data goes to disk.
+ *
+ * The first time step written with an output object creates its
+ * file, which reads the mesh and its boundary data and may have to
+ * communicate, so it is written right away on the calling thread.
+ * For every later time step the calling thread gathers the solution
+ * into a buffer owned by the queued write, and the writer thread
+ * only puts those values into the already open file: it neither
+ * reads the mesh nor communicates.  The mesh, its boundary data and
+ * the solution may therefore be modified as soon as a write has been
+ * queued; only the output objects themselves must outlive it.
+ *
+ * ExodusII files are gathered onto processor 0 as usual; Nemesis
+ * files are written by every processor from its own piece of a
+ * distributed solution, so meshes of either kind are supported.
+ *
+ * A single writer thread performs the queued writes in order.  At
+ * most \p max_pending writes may be queued: queueing another blocks
+ * until the writer has caught up.  Call \p flush() to wait for all
+ * queued writes, e.g. before reading the output files back.
+ *
+ * If a write throws on the writer thread, the writes queued after it
+ * are discarded and the exception is rethrown on the calling thread
+ * by the next call to \p flush() or \p enqueue().
+ *
+ * Writes are performed synchronously if libMesh was built without
+ * pthreads.
+ */
+class AsyncMeshOutput
+{
+public:
+
+  /**
+   * A write operation to be performed by the writer thread.  A Job
+   * must own all the data it needs to write, and must not
+   * communicate.
+   */
+  class Job
+  {
+  public:
+    virtual ~Job () {}
+
+    /**
+     * Performs the write.
+     */
+    virtual void run () = 0;
+  };
+
+  /**
+   * Constructor.  At most \p max_pending writes will be queued
+   * before further writes block.
+   */
+  explicit
+  AsyncMeshOutput (const unsigned int max_pending = 2);
+
+  /**
+   * Destructor.  Waits for all pending writes to finish, then stops
+   * the writer thread.  A destructor must not throw, so a failed
+   * write not yet reported by \p flush() is only printed.
+   */
+  ~AsyncMeshOutput ();
+
+  /**
+   * Queues writing the solution of \p es at a time step, as in
+   * ExodusII_IO::write_timestep().  Must be called on all
+   * processors.
+   */
+  void write_timestep (ExodusII_IO& io,
+                       const std::string& fname,
+                       const EquationSystems& es,
+                       const int timestep,
+                       const Real time);
+
+  /**
+   * Queues writing the solution of \p es at a time step, as in
+   * Nemesis_IO::write_timestep().  Must be called on all
+   * processors.
+   */
+  void write_timestep (Nemesis_IO& io,
+                       const std::string& fname,
+                       const EquationSystems& es,
+                       const int timestep,
+                       const Real time);
+
+  /**
+   * Queues \p job, taking ownership of it.  If \p max_pending jobs
+   * are already queued this blocks until one has been written.
+   * Rethrows the exception of an earlier failed write, if any,
+   * instead of queueing \p job.
+   */
+  void enqueue (Job* job);
+
+  /**
+   * Blocks until all queued writes have been performed.  The next
+   * time step written with each output object is then written
+   * synchronously, so an output object may be destroyed or reused
+   * for another file once this has returned.  Rethrows the
+   * exception of a failed write, if any.
+   */
+  void flush ();
+
+  /**
+   * Returns the number of queued writes not yet performed.
+   */
+  unsigned int n_pending () const;
+
+private:
+
+#ifdef LIBMESH_HAVE_PTHREAD
+  /**
+   * Entry point of the writer thread.
+   */
+  static void * run_writer (void * args);
+
+  /**
+   * Runs queued jobs as they arrive, until \p _stopping is set.
+   */
+  void drain ();
+
+  /**
+   * Rethrows the exception of a failed write, if any, and clears
+   * it.  \p _mutex must be held.
+   */
+  void rethrow_error ();
+#endif
+
+  /**
+   * The maximum number of queued writes.
+   */
+  const unsigned int _max_pending;
+
+  /**
+   * Queued writes, in order.  The front job is the one being written.
+   */
+  std::deque<Job*> _pending;
+
+  /**
+   * The output objects which have written a time step since the
+   * last \p flush(), and so have their files open.  This only
+   * depends on the sequence of calls, so all processors agree on
+   * which writes are queued.
+   */
+  std::set<const void*> _open_files;
+
+#ifdef LIBMESH_HAVE_PTHREAD
+  /**
+   * True once the writer thread has been started.
+   */
+  bool _writer_started;
+
+  /**
+   * Set to tell the writer thread to exit once the queue is empty.
+   */
+  bool _stopping;
+
+  /**
+   * The writer thread.
+   */
+  pthread_t _writer;
+
+  /**
+   * Protects \p _pending and \p _stopping.
+   */
+  mutable Threads::mutex _mutex;
+
+  /**
+   * Signalled when a job is queued, or the writer should stop.
+   */
+  Threads::condition_variable _job_queued;
+
+  /**
+   * Signalled when the writer has finished a job.
+   */
+  Threads::condition_variable _job_done;
+
+  /**
+   * True if a write has thrown and not been reported yet.
+   */
+  bool _failed;
+
+  /**
+   * The message of the exception thrown by a failed write.
+   */
+  std::string _error_message;
+
+#ifdef LIBMESH_HAVE_CXX11
+  /**
+   * The exception thrown by a failed write, rethrown on the calling
+   * thread.
+   */
+  std::exception_ptr _error;
+#endif
+#endif
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_ASYNC_MESH_OUTPUT_H
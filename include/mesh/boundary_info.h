@@ -26,6 +26,7 @@
 #include "libmesh/parallel_object.h"
 
 // C++ includes
+#include LIBMESH_INCLUDE_UNORDERED_MULTIMAP
 #include <cstddef>
 #include <map>
 #include <set>
@@ -98,6 +99,11 @@ public:
    * Before this is called the \p boundary_mesh data structure is
    * empty.
    *
+   * If this mesh is distributed and \p boundary_mesh is a
+   * \p ParallelMesh, each processor builds only the sides of its
+   * local and ghost elements; otherwise this mesh is temporarily
+   * serialized.
+   *
    * If you are using a MeshData class with this Mesh, you can
    * pass a pointer to both the boundary_mesh's MeshData object,
    * and the MeshData object used for this mesh.
@@ -498,6 +504,16 @@ public:
 
 private:
 
+  /**
+   * The boundary ids of nodes, and of the edges or sides of
+   * elements, hashed by the node or element, so that looking up the
+   * ids of a node or side without any is as cheap as possible.
+   */
+  typedef LIBMESH_BEST_UNORDERED_MULTIMAP<const Node*,
+                                          boundary_id_type> node_map_type;
+  typedef LIBMESH_BEST_UNORDERED_MULTIMAP<const Elem*,
+                                          std::pair<unsigned short int, boundary_id_type> >
+  elem_map_type;
 
   /**
    * The Mesh this boundary info pertains to.
@@ -508,24 +524,19 @@ private:
    * Data structure that maps nodes in the mesh
    * to boundary ids.
    */
-  std::multimap<const Node*,
-                boundary_id_type> _boundary_node_id;
+  node_map_type _boundary_node_id;
 
   /**
    * Data structure that maps edges of elements
    * to boundary ids. This is only relevant in 3D.
    */
-  std::multimap<const Elem*,
-                std::pair<unsigned short int, boundary_id_type> >
-  _boundary_edge_id;
+  elem_map_type _boundary_edge_id;
 
   /**
    * Data structure that maps sides of elements
    * to boundary ids.
    */
-  std::multimap<const Elem*,
-                std::pair<unsigned short int, boundary_id_type> >
-  _boundary_side_id;
+  elem_map_type _boundary_side_id;
 
   /**
    * A collection of user-specified boundary ids for sides, edges and nodes.
@@ -636,34 +647,6 @@ private:
 
 };
 
-
-
-
-
-
-// ------------------------------------------------------------
-// BoundaryInfo inline methods
-inline
-void BoundaryInfo::remove (const Node* node)
-{
-  libmesh_assert(node);
-
-  // Erase everything associated with node
-  _boundary_node_id.erase (node);
-}
-
-
-
-inline
-void BoundaryInfo::remove (const Elem* elem)
-{
-  libmesh_assert(elem);
-
-  // Erase everything associated with elem
-  _boundary_edge_id.erase (elem);
-  _boundary_side_id.erase (elem);
-}
-
 } // namespace libMesh
 
 #endif // LIBMESH_BOUNDARY_INFO_H
@@ -85,11 +85,21 @@ public:
 
   /**
    * This method implements reading a mesh from a specified file.
+   *
+   * A ParallelMesh checkpoint may be read on a different number of
+   * processors than it was written on.  Each processor reads a
+   * contiguous range of the per-processor chunks, and takes
+   * ownership of the elements and nodes owned by their writers; the
+   * mesh may then be repartitioned, e.g. by prepare_for_use().
    */
   virtual void read (const std::string&);
 
   /**
    * This method implements writing a mesh to a specified file.
+   *
+   * A ParallelMesh is written with one chunk file per processor,
+   * named with a "-<processor id>" suffix, plus an index file
+   * recording the number of chunks.
    */
   virtual void write (const std::string&);
 
@@ -142,6 +152,19 @@ private:
 
   //---------------------------------------------------------------------------
   // Read Implementation
+  /**
+   * Read one checkpoint file: the whole mesh for a serial mesh, or
+   * one writing processor's part of a parallel mesh.
+   */
+  void read_chunk (const std::string& file_name);
+
+  /**
+   * Returns the processor which reads the parallel checkpoint chunk
+   * written by processor \p chunk, and so takes ownership of the
+   * objects that processor owned.
+   */
+  processor_id_type chunk_reader (const largest_id_type chunk) const;
+
   /**
    * Read subdomain name information - NEW in 0.9.2 format
    */
@@ -182,6 +205,12 @@ private:
 
   bool _binary;
   std::string _version;
+
+  /**
+   * The number of chunks a parallel checkpoint being read was
+   * written in, or 0 when reading a serial checkpoint.
+   */
+  largest_id_type _n_chunks;
 };
 
 
@@ -172,6 +172,18 @@ public:
                        const int timestep,
                        const Real time);
 
+  /**
+   * Writes out nodal data at a specific timestep, as
+   * write_timestep() does, where the (serialized) nodal data and
+   * variable names are provided.
+   * @param timestep The timestep to write out, should be _1_ indexed.
+   */
+  void write_timestep_nodal_data (const std::string& fname,
+                                  const std::vector<Number>& soln,
+                                  const std::vector<std::string>& names,
+                                  const int timestep,
+                                  const Real time);
+
   /**
    * Sets the list of variable names to be included in the output.
    * This is _optional_.  If this is never called then all variables
@@ -33,6 +33,7 @@ namespace libMesh
 
 // Forward declarations
 class MeshBase;
+class TextFileBuffer;
 
 
 
@@ -72,6 +73,12 @@ public:
    * Reads in a mesh in the Gmsh *.msh format from the ASCII file
    * given by name.
    *
+   * The file is normally parsed on processor 0, and the mesh is then
+   * broadcast to the other processors.  If parallel_read() is set and
+   * the mesh is a ParallelMesh, every processor instead parses its
+   * own share of the file, and the elements are left distributed
+   * among the processors in the order in which they appear in the file.
+   *
    * The user is responsible for calling Mesh::prepare_for_use()
    * after reading the mesh and before using it.
    */
@@ -103,6 +110,13 @@ public:
    */
   bool & binary ();
 
+  /**
+   * Flag indicating whether or not every processor should parse a
+   * share of the file in read().  This only has an effect when
+   * reading into a ParallelMesh on more than one processor.
+   */
+  bool & parallel_read ();
+
 
 private:
   /**
@@ -110,7 +124,17 @@ private:
    * is called by the public interface function and implements
    * reading the file.
    */
-  virtual void read_mesh (std::istream& in);
+  virtual void read_mesh (const TextFileBuffer& buffer);
+
+  /**
+   * Implementation of the read() function for a ParallelMesh, in
+   * which each processor parses a contiguous range of the lines of
+   * the nodes and elements sections.  The nodes each processor
+   * needs are then found by hashing the Gmsh node numbers among the
+   * processors, and side boundary conditions are matched up by
+   * hashing the node ids of the sides.
+   */
+  void read_mesh_parallel (const TextFileBuffer& buffer);
 
   /**
    * This method implements writing a mesh to a
@@ -131,6 +155,11 @@ private:
    * Flag to write binary data.
    */
   bool _binary;
+
+  /**
+   * Flag to read the file on all processors.
+   */
+  bool _parallel_read;
 };
 
 
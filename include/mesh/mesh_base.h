@@ -37,6 +37,7 @@
 // C++ Includes   -----------------------------------
 #include <cstddef>
 #include <string>
+#include <utility>
 
 namespace libMesh
 {
@@ -131,6 +132,66 @@ public:
   bool is_prepared () const
   { return _is_prepared; }
 
+  /**
+   * The mesh keeps a set of revision counters, each of which is
+   * incremented every time the mesh is modified in a particular way.
+   * Data derived from the mesh can be cached along with the revisions
+   * it was computed at, and only rebuilt once one of those revisions
+   * changes.  All revisions are incremented by \p prepare_for_use()
+   * and \p clear().
+   *
+   * The topology revision changes whenever elements or nodes are
+   * added, removed or renumbered, or neighbor links are rebuilt.
+   */
+  unsigned int topology_revision () const
+  { return _topology_revision; }
+
+  /**
+   * The geometry revision changes whenever nodes are added or removed,
+   * or moved by the \p MeshTools::Modification functions or a mesh
+   * smoother.
+   */
+  unsigned int geometry_revision () const
+  { return _geometry_revision; }
+
+  /**
+   * The partitioning revision changes whenever the processor ids of
+   * elements and nodes are reassigned by a \p Partitioner.
+   */
+  unsigned int partitioning_revision () const
+  { return _partitioning_revision; }
+
+  /**
+   * The boundary revision changes whenever boundary ids are added to
+   * or removed from the mesh's \p BoundaryInfo.
+   */
+  unsigned int boundary_revision () const
+  { return _boundary_revision; }
+
+  /**
+   * Increment the corresponding revision, invalidating any data
+   * cached from it.  Code which modifies the mesh directly rather than
+   * through the \p MeshBase interface (e.g. by moving nodes, or by
+   * changing the processor ids or refinement states of elements)
+   * should call these afterwards.
+   */
+  void increment_topology_revision ()
+  { ++_topology_revision; }
+
+  void increment_geometry_revision ()
+  { ++_geometry_revision; }
+
+  void increment_partitioning_revision ()
+  { ++_partitioning_revision; }
+
+  void increment_boundary_revision ()
+  { ++_boundary_revision; }
+
+  /**
+   * Increment all of the revisions above.
+   */
+  void increment_revisions ();
+
   /**
    * @returns \p true if all elements and nodes of the mesh
    * exist on the current processor, \p false otherwise
@@ -566,6 +627,19 @@ public:
   void skip_partitioning(bool skip) { _skip_partitioning = skip; }
   bool skip_partitioning() const { return _skip_partitioning; }
 
+  /**
+   * Sets the number of layers of point-neighbor ghost elements which
+   * a distributed mesh keeps around its local elements.  The default
+   * single layer suffices for face neighbor consistency and standard
+   * continuous discretizations; wider stencils (patch recovery, DG,
+   * nonlocal contact) may need more.  This must be set identically
+   * on every processor before the mesh is distributed.  Serial
+   * meshes keep every element and ignore this setting.
+   */
+  void set_n_ghost_layers(unsigned int n_layers)
+  { libmesh_assert_greater (n_layers, 0); _n_ghost_layers = n_layers; }
+  unsigned int n_ghost_layers() const { return _n_ghost_layers; }
+
   /**
    * Constructs a list of all subdomain identifiers in the global mesh.
    * Subdomains correspond to separate subsets of the mesh which could correspond
@@ -927,6 +1001,52 @@ public:
   virtual const_node_iterator bnd_nodes_begin () const = 0;
   virtual const_node_iterator bnd_nodes_end () const = 0;
 
+  /**
+   * Returns a list of the active elements in the mesh, in the same
+   * order as the active element iterators would visit them.  The list
+   * is cached, and only rebuilt when the topology or partitioning
+   * revision has changed since it was last requested, so repeated
+   * loops over the same subset of the mesh (and \p ConstElemRange
+   * objects built from the list) don't pay for the predicated
+   * iterators each time.
+   *
+   * Since the cache is built on demand, these methods should not be
+   * called concurrently from multiple threads.
+   *
+   * Elements don't know which mesh they belong to, so changes made
+   * directly to an \p Elem, such as assigning its \p subdomain_id(),
+   * \p processor_id() or refinement flag, cannot invalidate the cache.
+   * Code which does so has to call \p increment_topology_revision()
+   * (or \p increment_partitioning_revision(), for processor ids)
+   * afterwards.  Debug builds check each list against the element
+   * iterators the first time it is reused at a given revision, and
+   * assert if it is stale.
+   */
+  const std::vector<const Elem*> & active_element_list () const;
+
+  /**
+   * Returns a cached list of the active elements owned by this
+   * processor.
+   */
+  const std::vector<const Elem*> & active_local_element_list () const;
+
+  /**
+   * Returns a cached list of the active elements owned by this
+   * processor in subdomain \p subdomain_id.
+   */
+  const std::vector<const Elem*> &
+  active_local_subdomain_element_list (subdomain_id_type subdomain_id) const;
+
+  /**
+   * Returns a cached list of the sides on the boundary of the mesh,
+   * i.e. those without a neighbor, of the active elements owned by
+   * this processor.  Each entry is an element and one of its side
+   * numbers; elements come in the order of the active local element
+   * iterators, and their sides in increasing order.
+   */
+  const std::vector<std::pair<const Elem*, unsigned short int> > &
+  active_local_boundary_side_list () const;
+
   /**
    * Return a writeable reference to the whole subdomain name map
    */
@@ -987,6 +1107,79 @@ protected:
    */
   bool _is_prepared;
 
+  /**
+   * The revisions of the mesh.
+   */
+  unsigned int _topology_revision;
+  unsigned int _geometry_revision;
+  unsigned int _partitioning_revision;
+
+  /**
+   * The boundary revision is mutable so that the \p BoundaryInfo,
+   * which only holds a const reference to its mesh, can bump it.
+   */
+  mutable unsigned int _boundary_revision;
+
+  /**
+   * The topology and partitioning revisions a list cached from the
+   * mesh was built at.
+   */
+  struct CachedList
+  {
+    CachedList () :
+      topology_revision(libMesh::invalid_uint),
+      partitioning_revision(libMesh::invalid_uint),
+      checked(false) {}
+
+    bool is_current (const MeshBase & mesh) const
+    {
+      return topology_revision == mesh.topology_revision() &&
+        partitioning_revision == mesh.partitioning_revision();
+    }
+
+    void update (const MeshBase & mesh)
+    {
+      topology_revision = mesh.topology_revision();
+      partitioning_revision = mesh.partitioning_revision();
+      checked = false;
+    }
+
+    unsigned int topology_revision;
+    unsigned int partitioning_revision;
+
+    /**
+     * True once debug builds have checked the list against the
+     * iterators it was built from, which they do the first time it is
+     * reused at these revisions.
+     */
+    bool checked;
+  };
+
+  /**
+   * A list of elements cached from the mesh.
+   */
+  struct CachedElemList : public CachedList
+  {
+    std::vector<const Elem*> elems;
+  };
+
+  /**
+   * A list of element sides cached from the mesh.
+   */
+  struct CachedSideList : public CachedList
+  {
+    std::vector<std::pair<const Elem*, unsigned short int> > sides;
+  };
+
+  /**
+   * The lists returned by the \p *_element_list() and
+   * \p *_side_list() methods.
+   */
+  mutable CachedElemList _active_elem_list;
+  mutable CachedElemList _active_local_elem_list;
+  mutable std::map<subdomain_id_type, CachedElemList> _active_local_subdomain_elem_lists;
+  mutable CachedSideList _active_local_boundary_side_list;
+
   /**
    * A \p PointLocator class for this mesh.
    * This will not actually be built unless needed. Further, since we want
@@ -1023,6 +1216,12 @@ protected:
    */
   bool _skip_renumber_nodes_and_elements;
 
+  /**
+   * The number of layers of ghost elements a distributed mesh keeps
+   * around its local elements.
+   */
+  unsigned int _n_ghost_layers;
+
   /**
    * This structure maintains the mapping of named blocks
    * for file formats that support named blocks.  Currently
@@ -100,7 +100,9 @@ public:
   void redistribute (ParallelMesh &) const;
 
   /**
-   *
+   * Gathers the ghost elements (and their family trees) which touch
+   * our local elements from the processors owning them, out to
+   * \p MeshBase::n_ghost_layers() layers of point neighbors.
    */
   void gather_neighboring_elements (ParallelMesh &) const;
 
@@ -309,6 +309,13 @@ public:
                   unsigned int node,
                   processor_id_type proc_id);
 
+  /**
+   * Returns a new child \p child of \p parent, which is not yet in
+   * the mesh.
+   */
+  Elem* build_child (Elem& parent,
+                     unsigned int child);
+
   /**
    * Adds the element \p elem to the mesh.
    */
@@ -656,11 +663,36 @@ private:
                                  const PointLocatorBase* point_locator,
                                  Elem* neighbor);
 
+  /**
+   * The children of an element to be refined and where their nodes
+   * come from, the functor which works that out concurrently for all
+   * the elements being refined, and the functors which match up and
+   * record the nodes they create concurrently by shard of the
+   * _new_nodes_map.  All are defined in mesh_refinement.C.
+   */
+  struct ChildNodes;
+  class ComputeChildNodes;
+  class MatchNewNodes;
+  class AddNewNodes;
+
+  /**
+   * Functor which checks active elements' coarsening flags against
+   * their neighbors' for make_coarsening_compatible().
+   */
+  class CheckCoarseningFlags;
+
   /**
    * Data structure that holds the new nodes information.
    */
   TopologyMap _new_nodes_map;
 
+  /**
+   * The ChildNodes of the element being refined by
+   * _refine_elements(), which build_child() and add_node() use rather
+   * than computing them again; or NULL.
+   */
+  ChildNodes* _child_nodes;
+
   /**
    * Reference to the mesh.
    */
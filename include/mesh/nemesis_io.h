@@ -91,6 +91,37 @@ public:
    */
   void write_nodal_data (const std::string& fname, const std::vector<Number>& soln, const std::vector<std::string>& names);
 
+  /**
+   * Output the nodal solution of \p es.  Each processor writes only
+   * the nodes in its own file, fetching their values from the
+   * distributed solution, so nothing is gathered onto one processor.
+   */
+  virtual void write_equation_systems (const std::string& fname,
+                                       const EquationSystems& es,
+                                       const std::set<std::string>* system_names=NULL);
+
+  /**
+   * Fetches the nodal solution of \p es at the nodes in this
+   * processor's file into \p file_values, and the variable names into
+   * \p names, to be written later by \p write_file_timestep().  The
+   * file must already have been written to, by \p write_timestep().
+   * Must be called on all processors.
+   */
+  void build_file_nodal_solution (const EquationSystems& es,
+                                  std::vector<Number>& file_values,
+                                  std::vector<std::string>& names);
+
+  /**
+   * Writes \p file_values and \p names, as built by
+   * \p build_file_nodal_solution(), at a time step.  Neither
+   * communicates nor reads the mesh, so it may be called on a
+   * different thread than the one which built the values.
+   */
+  void write_file_timestep (const std::vector<Number>& file_values,
+                            const std::vector<std::string>& names,
+                            const int timestep,
+                            const Real time);
+
   /**
    * Set the flag indicationg if we should be verbose.
    */
@@ -116,6 +147,13 @@ public:
 
 private:
 #if defined(LIBMESH_HAVE_EXODUS_API) && defined(LIBMESH_HAVE_NEMESIS_API)
+  /**
+   * Opens or creates the file \p fname for this processor, writing
+   * the mesh and the nodal variable names \p names if it is new.
+   */
+  void prepare_to_write_nodal_data (const std::string& fname,
+                                    const std::vector<std::string>& names);
+
   Nemesis_IO_Helper *nemhelper;
 #endif
   int _timestep;
@@ -32,6 +32,9 @@
 namespace libMesh
 {
 
+// Forward declarations
+template <typename T> class NumericVector;
+
 // The Nemesis API header file.  Should already be
 // correctly extern C'd but it doesn't hurt :)
 namespace Nemesis {
@@ -301,6 +304,34 @@ public:
                             const std::vector<std::string>& names,
                             int timestep);
 
+  /**
+   * Outputs the nodal solution for the nodes in this processor's file,
+   * fetching just those entries from the distributed vector built by
+   * \p EquationSystems::build_parallel_solution_vector().
+   */
+  void write_nodal_solution(const NumericVector<Number>& parallel_soln,
+                            const std::vector<std::string>& names,
+                            int timestep);
+
+  /**
+   * Fetches from \p parallel_soln, as built by
+   * \p EquationSystems::build_parallel_solution_vector(), the values
+   * of the \p num_vars variables at the nodes in this processor's
+   * file, in the order \p write_file_nodal_solution() expects.
+   */
+  void fetch_file_nodal_solution(const NumericVector<Number>& parallel_soln,
+                                 int num_vars,
+                                 std::vector<Number>& file_values);
+
+  /**
+   * Outputs the solution for the nodes of this file, given in the
+   * order of the file with the variables of each node contiguous.
+   * Does no communication, and reads nothing but this object.
+   */
+  void write_file_nodal_solution(const std::vector<Number>& file_values,
+                                 int num_vars,
+                                 int timestep);
+
   /**
    * Given base_filename, foo.e, constructs the Nemesis filename
    * foo.e.X.Y, where X=n. CPUs and Y=processor ID
@@ -162,7 +162,9 @@ public:
   /**
    * Deletes all nonlocal elements of the mesh
    * except for "ghosts" which touch a local element, and deletes
-   * all nodes which are not part of a local or ghost element
+   * all nodes which are not part of a local or ghost element.
+   * If n_ghost_layers() is greater than one, elements touching
+   * the ghosts are kept as well, out to that many layers.
    */
   virtual void delete_remote_elements();
 
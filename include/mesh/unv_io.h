@@ -37,6 +37,7 @@ namespace libMesh
 // Forward declarations
 class MeshBase;
 class MeshData;
+class TextParser;
 
 /**
  * The \p UNVIO class implements the Ideas \p UNV universal
@@ -93,10 +94,10 @@ private:
 
   /**
    * The actual implementation of the read function.
-   * The public read interface simply decides which
-   * type of stream to pass the implementation.
+   * The public read interface simply decides where
+   * the characters of the file come from.
    */
-  void read_implementation (std::istream& in_stream);
+  void read_implementation (TextParser& in_file);
 
   /**
    * The actual implementation of the write function.
@@ -111,7 +112,7 @@ private:
   /**
    * Read nodes from file.
    */
-  void nodes_in (std::istream& in_file);
+  void nodes_in (TextParser& in_file);
 
   /**
    * Method reads elements and stores them in
@@ -120,13 +121,13 @@ private:
    * ignored, but \p MeshData takes care of such things
    * (if active).
    */
-  void elements_in (std::istream& in_file);
+  void elements_in (TextParser& in_file);
 
   /**
    * Reads the "groups" section of the file. The format of the groups section is described here:
    * http://www.sdrl.uc.edu/universal-file-formats-for-modal-analysis-testing-1/file-format-storehouse/unv_2467.htm
    */
-  void groups_in(std::istream& in_file);
+  void groups_in(TextParser& in_file);
 
   //-------------------------------------------------------------
   // write support methods
@@ -49,9 +49,20 @@ class MeshData;
  * Format description:
  * cf. <a href="http://www.vtk.org/">VTK home page</a>.
  *
- * This class will not have any functionality unless VTK is detected
+ * Reading requires VTK, so it is only available if VTK is detected
  * during configure and hence LIBMESH_HAVE_VTK is defined.
  *
+ * Output is written by libMesh itself and does not need VTK.  Each
+ * processor writes its active local elements, their nodes and the
+ * nodal solution values to its own .vtu piece, as raw or base64
+ * encoded binary appended data, and processor 0 writes a .pvtu index
+ * of the pieces.  The data is streamed to the files directly from the
+ * mesh and solution, and \p write_equation_systems() fetches only the
+ * solution values each piece needs rather than gathering the whole
+ * solution.  A file name ending in .vtu on a single processor is
+ * written as a plain .vtu file.  Compressed output still goes through
+ * VTK.
+ *
  * @author Wout Ruijter, 2007
  * (Checked in to LibMesh by J.W. Peterson)
  */
@@ -85,12 +96,13 @@ public:
                                  const std::vector<std::string>&);
 
   /**
-   * Overloads writing equation systems, this is done because when overloading
-   * write_nodal_data there would be no way to export cell centered data
+   * Writes the nodal solution of \p es.  Each processor fetches only
+   * the values for the nodes in its own piece from the distributed
+   * solution, so nothing is gathered onto one processor.
    */
-  // virtual void write_equation_systems(const std::string& fname,
-  //                                     const EquationSystems& es,
-  //                                     const std::set<std::string>* system_names=NULL);
+  virtual void write_equation_systems (const std::string& fname,
+                                       const EquationSystems& es,
+                                       const std::set<std::string>* system_names=NULL);
 
   /**
    * This method implements reading a mesh from a specified file
@@ -109,12 +121,34 @@ public:
   vtkUnstructuredGrid* get_vtk_grid();
 
   /**
-   * Setter for compression flag
+   * Setter for compression flag.  Compressed output is written through
+   * VTK, so this has no effect if VTK is not available.
    */
   void set_compression(bool b);
 
+  /**
+   * Setter for base64 encoding of the appended data.  By default the
+   * data is written as raw binary.
+   */
+  void set_base64_encoding(bool b);
+
 private:
+
+  /**
+   * Returns true if output has to be written through VTK rather than
+   * by libMesh's own writer.
+   */
+  bool use_vtk_writer () const;
+
 #ifdef LIBMESH_HAVE_VTK
+  /**
+   * Writes the grid through VTK, with the nodal data \p soln for the
+   * variables \p names.
+   */
+  void write_vtk_grid (const std::string& fname,
+                       const std::vector<Number>& soln,
+                       const std::vector<std::string>& names);
+
   /**
    * Map libMesh element types to VTK element types
    */
@@ -152,6 +186,11 @@ private:
    */
   bool _compress;
 
+  /**
+   * Flag to indicate whether appended data should be base64 encoded
+   */
+  bool _base64;
+
   /**
    * maps global node id to node id of partition
    */
@@ -45,7 +45,6 @@
 #endif
 
 #ifdef LIBMESH_HAVE_PTHREAD
-#  include "libmesh/libmesh_logging.h" // only mess with the perflog if we are really multithreaded
 #  include <pthread.h>
 #  include <algorithm>
 #  include <vector>
@@ -181,7 +180,7 @@ void parallel_for (const Range &range, const Body &body)
 {
   BoolAcquire b(in_threads);
 
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
+#if defined(LIBMESH_ENABLE_PERFORMANCE_LOGGING) && !defined(LIBMESH_HAVE_PTHREAD)
   const bool logging_was_enabled = libMesh::perflog.logging_enabled();
 
   if (libMesh::n_threads() > 1)
@@ -194,7 +193,7 @@ void parallel_for (const Range &range, const Body &body)
   else
     body(range);
 
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
+#if defined(LIBMESH_ENABLE_PERFORMANCE_LOGGING) && !defined(LIBMESH_HAVE_PTHREAD)
   if (libMesh::n_threads() > 1 && logging_was_enabled)
     libMesh::perflog.enable_logging();
 #endif
@@ -213,7 +212,7 @@ void parallel_for (const Range &range, const Body &body, const Partitioner &part
 {
   BoolAcquire b(in_threads);
 
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
+#if defined(LIBMESH_ENABLE_PERFORMANCE_LOGGING) && !defined(LIBMESH_HAVE_PTHREAD)
   const bool logging_was_enabled = libMesh::perflog.logging_enabled();
 
   if (libMesh::n_threads() > 1)
@@ -226,7 +225,7 @@ void parallel_for (const Range &range, const Body &body, const Partitioner &part
   else
     body(range);
 
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
+#if defined(LIBMESH_ENABLE_PERFORMANCE_LOGGING) && !defined(LIBMESH_HAVE_PTHREAD)
   if (libMesh::n_threads() > 1 && logging_was_enabled)
     libMesh::perflog.enable_logging();
 #endif
@@ -245,7 +244,7 @@ void parallel_reduce (const Range &range, Body &body)
 {
   BoolAcquire b(in_threads);
 
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
+#if defined(LIBMESH_ENABLE_PERFORMANCE_LOGGING) && !defined(LIBMESH_HAVE_PTHREAD)
   const bool logging_was_enabled = libMesh::perflog.logging_enabled();
 
   if (libMesh::n_threads() > 1)
@@ -258,7 +257,7 @@ void parallel_reduce (const Range &range, Body &body)
   else
     body(range);
 
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
+#if defined(LIBMESH_ENABLE_PERFORMANCE_LOGGING) && !defined(LIBMESH_HAVE_PTHREAD)
   if (libMesh::n_threads() > 1 && logging_was_enabled)
     libMesh::perflog.enable_logging();
 #endif
@@ -277,7 +276,7 @@ void parallel_reduce (const Range &range, Body &body, const Partitioner &partiti
 {
   BoolAcquire b(in_threads);
 
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
+#if defined(LIBMESH_ENABLE_PERFORMANCE_LOGGING) && !defined(LIBMESH_HAVE_PTHREAD)
   const bool logging_was_enabled = libMesh::perflog.logging_enabled();
 
   if (libMesh::n_threads() > 1)
@@ -290,7 +289,7 @@ void parallel_reduce (const Range &range, Body &body, const Partitioner &partiti
   else
     body(range);
 
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
+#if defined(LIBMESH_ENABLE_PERFORMANCE_LOGGING) && !defined(LIBMESH_HAVE_PTHREAD)
   if (libMesh::n_threads() > 1 && logging_was_enabled)
     libMesh::perflog.enable_logging();
 #endif
@@ -501,13 +500,6 @@ void parallel_for (const Range &range, const Body &body)
 {
   Threads::BoolAcquire b(Threads::in_threads);
 
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
-  const bool logging_was_enabled = libMesh::perflog.logging_enabled();
-
-  if (libMesh::n_threads() > 1)
-    libMesh::perflog.disable_logging();
-#endif
-
   unsigned int n_threads = num_pthreads(range);
 
   std::vector<Range *> ranges(n_threads);
@@ -571,11 +563,6 @@ void parallel_for (const Range &range, const Body &body)
   // Clean up
   for(unsigned int i=0; i<n_threads; i++)
     delete ranges[i];
-
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
-  if (libMesh::n_threads() > 1 && logging_was_enabled)
-    libMesh::perflog.enable_logging();
-#endif
 }
 
 //-------------------------------------------------------------------
@@ -601,13 +588,6 @@ void parallel_reduce (const Range &range, Body &body)
 {
   Threads::BoolAcquire b(Threads::in_threads);
 
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
-  const bool logging_was_enabled = libMesh::perflog.logging_enabled();
-
-  if (libMesh::n_threads() > 1)
-    libMesh::perflog.disable_logging();
-#endif
-
   unsigned int n_threads = num_pthreads(range);
 
   std::vector<Range *> ranges(n_threads);
@@ -683,11 +663,6 @@ void parallel_reduce (const Range &range, Body &body)
     delete bodies[i];
   for(unsigned int i=0; i<n_threads; i++)
     delete ranges[i];
-
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
-  if (libMesh::n_threads() > 1 && logging_was_enabled)
-    libMesh::perflog.enable_logging();
-#endif
 }
 
 //-------------------------------------------------------------------
@@ -913,6 +888,85 @@ private:
 
 
 
+#ifdef LIBMESH_HAVE_PTHREAD
+//-------------------------------------------------------------------
+/**
+ * Mutex which blocks, rather than busy-waits, until the lock is
+ * acquired, and which a \p condition_variable can wait on.
+ */
+class mutex
+{
+public:
+  mutex () { pthread_mutex_init(&_mutex, NULL); }
+  ~mutex () { pthread_mutex_destroy(&_mutex); }
+
+  void lock () { pthread_mutex_lock(&_mutex); }
+  void unlock () { pthread_mutex_unlock(&_mutex); }
+
+  class scoped_lock
+  {
+  public:
+    scoped_lock () : _mtx(NULL) {}
+    explicit scoped_lock ( mutex& in_mutex ) : _mtx(&in_mutex) { _mtx->lock(); }
+
+    ~scoped_lock () { release(); }
+
+    void acquire ( mutex& in_mutex ) { _mtx = &in_mutex; _mtx->lock(); }
+    void release () { if(_mtx) _mtx->unlock(); _mtx = NULL; }
+
+  private:
+    mutex * _mtx;
+
+    friend class condition_variable;
+  };
+
+private:
+  // Not copyable
+  mutex (const mutex&);
+  mutex & operator= (const mutex&);
+
+  pthread_mutex_t _mutex;
+
+  friend class condition_variable;
+};
+
+//-------------------------------------------------------------------
+/**
+ * Condition variable, which lets a thread sleep until another thread
+ * changes some state protected by a \p mutex.  As with any condition
+ * variable, \p wait() may return spuriously, so it should be called
+ * in a loop which rechecks the condition.
+ */
+class condition_variable
+{
+public:
+  condition_variable () { pthread_cond_init(&_cond, NULL); }
+  ~condition_variable () { pthread_cond_destroy(&_cond); }
+
+  /**
+   * Atomically releases the mutex held by \p lock and waits to be
+   * notified, then reacquires the mutex.
+   */
+  void wait (mutex::scoped_lock & lock)
+  {
+    libmesh_assert(lock._mtx);
+    pthread_cond_wait(&_cond, &lock._mtx->_mutex);
+  }
+
+  void notify_one () { pthread_cond_signal(&_cond); }
+  void notify_all () { pthread_cond_broadcast(&_cond); }
+
+private:
+  // Not copyable
+  condition_variable (const condition_variable&);
+  condition_variable & operator= (const condition_variable&);
+
+  pthread_cond_t _cond;
+};
+#endif // LIBMESH_HAVE_PTHREAD
+
+
+
 /**
  * Blocked range which can be subdivided and executed in parallel.
  */
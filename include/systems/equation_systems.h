@@ -286,6 +286,16 @@ public:
   void build_solution_vector (std::vector<Number>& soln,
                               const std::set<std::string>* system_names=NULL) const;
 
+  /**
+   * Builds the same nodal solution values as \p build_solution_vector(),
+   * but leaves them in a distributed vector in which each processor
+   * owns the entries of its local nodes.  Parallel output formats
+   * can then fetch just the entries they write, rather than
+   * gathering the whole solution.
+   */
+  UniquePtr<NumericVector<Number> >
+  build_parallel_solution_vector (const std::set<std::string>* system_names=NULL) const;
+
   /**
    * Retrieve the solution data for CONSTANT MONOMIALs.  If \p names
    * is populated, only the variables corresponding to those names will
@@ -364,6 +374,12 @@ public:
    * If XdrMODE is omitted, it will be inferred as WRITE for filenames
    * containing .xda or as ENCODE for filenames containing .xdr
    *
+   * With WRITE_PARALLEL_FILES (the default on a distributed mesh)
+   * each processor writes its own data to a separate chunk file,
+   * e.g. "out.xdr.chunk0003" for processor 3, which records node and
+   * element ids, so that the data can be read back on any number of
+   * processors without being gathered onto any one of them.
+   *
    * @param partition_agnostic If true then the mesh and degrees of freedom
    * will be temporarily renumbered in a partition agnostic way so that
    * files written using "n" mpi processes can be re-read on "m" mpi
@@ -40,6 +40,8 @@ namespace libMesh
 // Forward Declarations
 class BoundaryInfo;
 class Elem;
+class FEBatch;
+class FETensorProduct;
 template <typename T> class FEGenericBase;
 typedef FEGenericBase<Real> FEBase;
 class QBase;
@@ -295,6 +297,42 @@ public:
    */
   FEBase* get_edge_fe( unsigned int var ) const;
 
+  /**
+   * Accessor for a sum factorization evaluator for variable var on
+   * the current element, for matrix-free residual evaluation with
+   * high-order tensor-product elements.  It uses a Gauss rule of the
+   * same order as the element quadrature rule, but builds no shape
+   * function tables, so the interior FE objects of such variables
+   * need not compute any.  The evaluator is built on the first call.
+   * Returns NULL if the variable's family or the current element is
+   * not supported by \p FETensorProduct.
+   */
+  FETensorProduct* get_element_tensor_fe( unsigned int var ) const;
+
+  /**
+   * Accessor for the batched interior finite element data of
+   * variable var, for elements of the current element's dimension.
+   * After elem_batch_fe_reinit() the data for the current element is
+   * at index get_batch_index() of the batch.  Returns NULL if the
+   * variable's family is not supported by \p FEBatch, or if no batch
+   * has been reinitialized yet.
+   */
+  FEBatch* get_element_batch_fe( unsigned int var ) const;
+
+  /**
+   * Index of the current element in the batch of the last
+   * elem_batch_fe_reinit(), or invalid_uint if it is not known.
+   */
+  unsigned int get_batch_index() const
+  { return _batch_index; }
+
+  /**
+   * Sets the index of the current element in the batch of the last
+   * elem_batch_fe_reinit().  pre_fe_reinit() resets it.
+   */
+  void set_batch_index( unsigned int k )
+  { _batch_index = k; }
+
   /**
    * Returns the value of the solution variable \p var at the quadrature
    * point \p qp on the current element interior. This is the preferred API.
@@ -588,6 +626,17 @@ public:
    */
   void elem_fe_reinit();
 
+  /**
+   * Reinitializes the batched interior FE data on \p elems, which
+   * must all have the same type and p level.  While the current
+   * element is element get_batch_index() of that batch,
+   * elem_fe_reinit() leaves the interior FE objects of batched
+   * variables alone, unless the mesh is moving; physics reads the
+   * batched data in place, and an FE object is only reinitialized
+   * when get_element_fe() hands it out.
+   */
+  void elem_batch_fe_reinit( const std::vector<const Elem*>& elems );
+
   /**
    * Reinitializes side FE objects on the current geometric element
    */
@@ -862,6 +911,32 @@ protected:
   std::vector<std::vector<FEAbstract*> > _side_fe_var;
   std::vector<FEAbstract*> _edge_fe_var;
 
+  /**
+   * Sum factorization evaluators for each element dimension and
+   * variable type which has asked for one.
+   */
+  mutable std::vector<std::map<FEType, FETensorProduct*> > _element_tensor_fe;
+
+  /**
+   * Batched interior FE data for each element dimension and
+   * supported variable type, once batching is used, and the index of
+   * the current element in the batch.
+   */
+  std::vector<std::map<FEType, FEBatch*> > _element_batch_fe;
+  unsigned int _batch_index;
+
+  /**
+   * Interior FE objects which elem_fe_reinit() left to the batch, and
+   * which have not been reinitialized on the current element since.
+   */
+  mutable std::vector<FEAbstract*> _deferred_element_fe;
+
+  /**
+   * Reinitializes \p fe on the current element if elem_fe_reinit()
+   * deferred that.
+   */
+  void reinit_deferred_fe( FEAbstract* fe ) const;
+
   /**
    * Saved reference to BoundaryInfo on the mesh for this System.
    * Used to answer boundary id requests.
@@ -952,6 +1027,8 @@ void FEMContext::get_element_fe( unsigned int var, FEGenericBase<OutputShape> *&
 {
   libmesh_assert( !_element_fe_var[dim].empty() );
   libmesh_assert_less ( var, (_element_fe_var[dim].size() ) );
+  if (!_deferred_element_fe.empty())
+    this->reinit_deferred_fe(_element_fe_var[dim][var]);
   fe = cast_ptr<FEGenericBase<OutputShape>*>( (_element_fe_var[dim][var] ) );
 }
 
@@ -960,6 +1037,8 @@ FEBase* FEMContext::get_element_fe( unsigned int var, unsigned char dim ) const
 {
   libmesh_assert( !_element_fe_var[dim].empty() );
   libmesh_assert_less ( var, (_element_fe_var[dim].size() ) );
+  if (!_deferred_element_fe.empty())
+    this->reinit_deferred_fe(_element_fe_var[dim][var]);
   return cast_ptr<FEBase*>( (_element_fe_var[dim][var] ) );
 }
 
@@ -193,6 +193,20 @@ public:
    */
   Real verify_analytic_jacobians;
 
+  /**
+   * If fe_batch_size is larger than one, assembly() reinitializes
+   * the batched FE data of the context (see
+   * FEMContext::get_element_batch_fe()) for up to this many
+   * consecutive elements of the same type and p level at a time.
+   * Physics then reads the batched data of such variables in place,
+   * at index FEMContext::get_batch_index(); their interior FE objects
+   * are only reinitialized if physics still asks the context for
+   * them, so batching only pays off for physics which uses the
+   * batched data throughout.  It is ignored on moving meshes.  It is
+   * 0 by default.
+   */
+  unsigned int fe_batch_size;
+
   /**
    * Syntax sugar to make numerical_jacobian() declaration easier.
    */
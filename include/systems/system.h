@@ -1291,6 +1291,19 @@ public:
                            const bool read_additional_data)
   { read_parallel_data<Number>(io, read_additional_data); }
 
+  /**
+   * Reads additional data, namely vectors, for this System from the
+   * per-processor chunks written by write_parallel_chunk(), which
+   * may have been written on a different number of processors.
+   * \p chunks are the chunks assigned to this processor, possibly
+   * none; the last processor must read the last chunk.  Values are
+   * redistributed in parallel to the processors owning each node and
+   * element, matched by id.
+   */
+  template <typename InValType>
+  void read_parallel_chunks (const std::vector<Xdr*> &chunks,
+                             const bool read_additional_data);
+
   /**
    * Writes the basic data header for this System.
    */
@@ -1322,6 +1335,15 @@ public:
   void write_parallel_data (Xdr &io,
                             const bool write_additional_data) const;
 
+  /**
+   * Writes additional data, namely vectors, for this System, in a
+   * per-processor chunk which records the ids of the local nodes and
+   * elements, so that it can be read back on any number of
+   * processors with read_parallel_chunks().
+   */
+  void write_parallel_chunk (Xdr &io,
+                             const bool write_additional_data) const;
+
   /**
    * @returns a string containing information about the
    * system.
@@ -26,18 +26,35 @@
 
 // C++ includes
 #include <cstddef>
+#include <iosfwd>
 #include <map>
-#include <stack>
 #include <string>
 #include <vector>
+#include <stdint.h> // uint64_t
 #include <sys/time.h>
 
+#ifdef LIBMESH_HAVE_PTHREAD
+#  include <pthread.h>
+#endif
+
+#ifdef LIBMESH_HAVE_STD_THREAD
+#  include <atomic>
+#endif
+
 namespace libMesh
 {
 
+// Forward declarations
+namespace Parallel {
+class Communicator;
+}
+
 /**
  * The \p PerfData class simply contains the performance
- * data that is recorded for individual events.
+ * data that is recorded for individual events.  While an
+ * event is being logged its times are accumulated in clock
+ * ticks; \p tot_time and \p tot_time_incl_sub are filled in
+ * when the \p PerfLog reports them.
  */
 
 // ------------------------------------------------------------
@@ -52,35 +69,51 @@ public:
   PerfData () :
     tot_time(0.),
     tot_time_incl_sub(0.),
-    tstart(),
-    tstart_incl_sub(),
+    tot_ticks(0),
+    tot_ticks_incl_sub(0),
+    tstart(0),
+    tstart_incl_sub(0),
     count(0),
+    rss_peak(0),
+    rss_growth(0),
+    n_allocations(0),
+    bytes_allocated(0),
     open(false),
     called_recursively(0)
   {}
 
 
   /**
-   * Total time spent in this event.
+   * Total time spent in this event, in seconds.
    */
   double tot_time;
 
   /**
-   * Total time spent in this event, including sub-events.
+   * Total time spent in this event, including sub-events,
+   * in seconds.
    */
   double tot_time_incl_sub;
 
   /**
-   * Structure defining when the event
-   * was last started.
+   * Total clock ticks spent in this event.
    */
-  struct timeval tstart;
+  uint64_t tot_ticks;
+
+  /**
+   * Total clock ticks spent in this event, including sub-events.
+   */
+  uint64_t tot_ticks_incl_sub;
+
+  /**
+   * The clock tick when the event was last started.
+   */
+  uint64_t tstart;
 
   /**
-   * Structure defining when the event
-   * was last started, including sub-events.
+   * The clock tick when the event was last started,
+   * including sub-events.
    */
-  struct timeval tstart_incl_sub;
+  uint64_t tstart_incl_sub;
 
   /**
    * The number of times this event has
@@ -88,6 +121,26 @@ public:
    */
   unsigned int count;
 
+  /**
+   * The largest resident set size, in bytes, seen while this event
+   * was running, if memory logging is enabled.
+   */
+  std::size_t rss_peak;
+
+  /**
+   * The total change in resident set size, in bytes, between the
+   * start and end of each call, if memory logging is enabled.
+   */
+  long rss_growth;
+
+  /**
+   * The number of calls to \p operator \p new made while this event
+   * was running, including its sub-events, and the bytes they
+   * requested, if allocations are being counted.
+   */
+  uint64_t n_allocations;
+  uint64_t bytes_allocated;
+
   /**
    * Flag indicating if we are currently
    * monitoring this event.  Should only
@@ -95,15 +148,24 @@ public:
    */
   bool open;
 
-  void   start ();
-  void   restart ();
-  double pause ();
-  double stopit ();
+  /**
+   * The following take the current clock tick \p now, so that
+   * pausing one event and starting the next reads the clock once.
+   * \p pause() and \p stopit() return the ticks elapsed since the
+   * event was last started or restarted.
+   */
+  void     start   (uint64_t now);
+  void     restart (uint64_t now);
+  uint64_t pause   (uint64_t now);
+  uint64_t stopit  (uint64_t now);
 
   int called_recursively;
 
-protected:
-  double stop_or_pause(const bool do_stop);
+  /**
+   * Adds the counts and times of \p other, e.g. as recorded
+   * on another thread.
+   */
+  PerfData & operator += (const PerfData &other);
 };
 
 
@@ -116,6 +178,29 @@ protected:
  * This class is particulary useful for finding performance
  * bottlenecks.
  *
+ * Events may be registered once with \p register_event() and then
+ * pushed and popped by their \p EventId, which avoids looking up
+ * the label on every call; this is what the \p START_LOG and
+ * \p STOP_LOG macros do.  Each thread keeps its own stack of
+ * running events, so events may be logged inside threaded loops
+ * without taking a lock; the per-thread data are summed when the
+ * log is printed.  Times
+ * are measured with the processor's time-stamp counter where it
+ * is available.
+ *
+ * When tracing is enabled, the beginning and end of every event are
+ * also recorded with their times, so that the log can be written as
+ * a timeline of each thread with \p write_trace_events().  Only the
+ * most recent events of each thread are kept.
+ *
+ * When memory logging is enabled, the resident set size of the
+ * process is sampled whenever an event starts or stops, and the
+ * peak and growth of each event are reported by
+ * \p get_memory_info().  The peak of an event is the largest of the
+ * samples taken while it ran, so memory which is allocated and freed
+ * again between two samples is missed.  Applications which include
+ * "libmesh/perf_log_allocations.h" in one of their source files also
+ * get the number and size of the allocations made by each event.
  */
 
 // ------------------------------------------------------------
@@ -125,6 +210,11 @@ class PerfLog
 
 public:
 
+  /**
+   * A handle for an event, as returned by \p register_event().
+   */
+  typedef unsigned int EventId;
+
   /**
    * Constructor.  \p label_name is the name of the object, which
    * will bw print in the log to distinguish it from other objects.
@@ -146,6 +236,7 @@ public:
    * checks to see if it is currently monitoring any
    * events, and if so errors.  Be sure you are not
    * logging any events when you call this function.
+   * Registered events remain valid.
    */
   void clear();
 
@@ -164,6 +255,20 @@ public:
    */
   bool logging_enabled() const { return log_events; }
 
+  /**
+   * Returns the handle for the event \p label under \p header,
+   * registering the event if this is the first time it is seen.
+   * This function is thread-safe.
+   */
+  EventId register_event (const std::string &label,
+                          const std::string &header="");
+
+  /**
+   * Push the registered event \p event onto the stack of the
+   * calling thread, pausing any active event.
+   */
+  void push (EventId event);
+
   /**
    * Push the event \p label onto the stack, pausing any active event.
    */
@@ -176,6 +281,12 @@ public:
   void push (const std::string &label,
              const std::string &header="");
 
+  /**
+   * Pop the registered event \p event off the stack of the calling
+   * thread, resuming any lower event.
+   */
+  void pop (EventId event);
+
   /**
    * Pop the event \p label off the stack, resuming any lower event.
    */
@@ -240,17 +351,311 @@ public:
   double get_elapsed_time() const;
 
   /**
-   * @returns the active time
+   * @returns the active time, summed over all threads.
    */
   double get_active_time() const;
 
   /**
-   * Return the PerfData object associated with a label and header.
+   * Return the PerfData object associated with a label and header,
+   * summed over all threads.
    */
   PerfData get_perf_data(const std::string &label, const std::string &header="");
 
+  /**
+   * Starts recording the beginning and end of each event, keeping
+   * the most recent \p max_events records of each thread.  Any
+   * previously traced events are discarded.  No events may be
+   * running on other threads when this is called.
+   */
+  void enable_tracing (std::size_t max_events = 1048576);
+
+  /**
+   * Stops recording events and discards the traced events.
+   */
+  void disable_tracing () { this->enable_tracing(0); }
+
+  /**
+   * Returns true iff events are being traced.
+   */
+  bool tracing_enabled () const { return trace_capacity != 0; }
+
+  /**
+   * Returns the wall-clock time, in seconds since the epoch, when
+   * the log was constructed or last cleared.
+   */
+  double get_start_time () const;
+
+  /**
+   * Writes the traced events in the Chrome trace-event format,
+   * each event as a JSON object followed by a comma and a newline,
+   * so that the output of several logs may be concatenated into the
+   * "traceEvents" array of a trace file.  The events are labeled
+   * with the process id \p pid and with the thread which ran them;
+   * their times are in microseconds since \p time_origin, in seconds
+   * since the epoch.  Events which were still running, or whose
+   * beginning has been overwritten, are omitted.
+   */
+  void write_trace_events (std::ostream &os,
+                           unsigned int pid,
+                           double time_origin) const;
+
+  /**
+   * Starts sampling the resident set size whenever an event starts
+   * or stops.  Each sample reads /proc/self/statm, which costs a
+   * system call, so it is only worth enabling when looking for
+   * memory problems.  It should be called before other threads
+   * start logging events.  Returns false, and leaves memory logging
+   * disabled, if the resident set size can not be read on this
+   * system.
+   */
+  bool enable_memory_logging ();
+
+  /**
+   * Returns true iff the resident set size is being sampled.
+   */
+  bool memory_logging_enabled () const { return statm_fd >= 0; }
+
+  /**
+   * Returns the current resident set size of the process in bytes,
+   * or 0 if memory logging is not enabled.
+   */
+  std::size_t get_rss () const;
+
+  /**
+   * Starts counting the allocations made by each event, on every
+   * \p PerfLog.  Called by "libmesh/perf_log_allocations.h", which
+   * replaces \p operator \p new so that it calls
+   * \p count_allocation(); it has no other way of seeing
+   * allocations.  Does nothing without thread_local support.
+   */
+  static void enable_allocation_counting ();
+
+  /**
+   * Returns true iff allocations are being counted.
+   */
+  static bool allocation_counting_enabled () { return count_allocations; }
+
+  /**
+   * Counts an allocation of \p bytes on the calling thread.
+   */
+  static void count_allocation (std::size_t bytes)
+  {
+#ifdef LIBMESH_HAVE_STD_THREAD
+    ++allocation_counts.n_allocations;
+    allocation_counts.bytes_allocated += bytes;
+#else
+    libmesh_ignore(bytes);
+#endif
+  }
+
+  /**
+   * @returns a table of the peak resident set size and the growth in
+   * resident set size of each event, with the largest values over
+   * all processors of \p comm and the processors they occurred on,
+   * and the allocations made by each event over all processors if
+   * allocations are being counted.
+   * This function must be called on all processors of \p comm; only
+   * processor 0 returns the table.
+   */
+  std::string get_memory_info (const Parallel::Communicator &comm) const;
+
+  /**
+   * Returns the current value of the clock used to time events.
+   * The length of a tick is only known approximately; see
+   * \p seconds_per_tick().
+   */
+  static uint64_t get_ticks();
+
 private:
 
+  /**
+   * The beginning or end of an event, as recorded for tracing.
+   */
+  struct TraceRecord
+  {
+    uint64_t ticks;
+    EventId event;
+    bool begin;
+  };
+
+  /**
+   * The allocations counted on a thread.
+   */
+  struct AllocationCounts
+  {
+    uint64_t n_allocations;
+    uint64_t bytes_allocated;
+  };
+
+  /**
+   * A running event, with the resident set size when it started,
+   * the largest resident set size seen since, and the allocations
+   * counted on its thread when it started.
+   */
+  struct StackEntry
+  {
+    EventId event;
+    std::size_t rss_start;
+    std::size_t rss_peak;
+    AllocationCounts allocations_start;
+  };
+
+  /**
+   * The events run by a single thread.
+   */
+  struct ThreadLog
+  {
+    ThreadLog (PerfLog &log, unsigned int thread_id) :
+      owner(log), id(thread_id), active_ticks(0),
+      trace_capacity(log.trace_capacity), trace_next(0), in_use(true)
+#ifdef LIBMESH_HAVE_STD_THREAD
+      , sequence(0)
+#endif
+    {
+#ifdef LIBMESH_HAVE_PTHREAD
+      pthread_mutex_init (&mutex, NULL);
+#endif
+    }
+
+    ~ThreadLog ()
+    {
+#ifdef LIBMESH_HAVE_PTHREAD
+      pthread_mutex_destroy (&mutex);
+#endif
+    }
+
+    /**
+     * The log this data belongs to.
+     */
+    PerfLog &owner;
+
+    /**
+     * The index of this data in \p thread_logs, which identifies
+     * the thread in the trace.
+     */
+    unsigned int id;
+
+    /**
+     * The data for each registered event this thread has run,
+     * indexed by \p EventId.
+     */
+    std::vector<PerfData> events;
+
+    /**
+     * The events currently running on this thread.
+     */
+    std::vector<StackEntry> stack;
+
+    /**
+     * The total number of ticks spent in logged events.
+     */
+    uint64_t active_ticks;
+
+    /**
+     * The most recent traced records, in a ring buffer of
+     * \p trace_capacity records which overwrites the oldest record
+     * once it is full, and the position of the next record.
+     */
+    std::vector<TraceRecord> trace;
+    std::size_t trace_capacity;
+    std::size_t trace_next;
+
+    /**
+     * False once the thread has exited, so that the data may be
+     * reused by a new thread.  Protected by the mutex of the
+     * \p PerfLog rather than that of the thread.
+     */
+    bool in_use;
+
+    /**
+     * Makes sure that \p event and the next trace record fit in the
+     * storage already allocated, so that logging it doesn't move any
+     * data another thread may be reading.  Must be called before
+     * \p begin_update().
+     */
+    void reserve (EventId event);
+
+    /**
+     * Bracket the changes the thread makes as it logs an event.
+     */
+    void begin_update ();
+    void end_update ();
+
+    /**
+     * Bracket a read of the data by another thread, which has to
+     * hold \p mutex.  The read is only consistent if \p read_retry()
+     * returns false for the value \p read_begin() returned;
+     * otherwise the thread logged an event meanwhile, and the read
+     * has to be repeated.
+     */
+    unsigned int read_begin () const;
+    bool read_retry (unsigned int begin) const;
+
+#ifdef LIBMESH_HAVE_PTHREAD
+    /**
+     * Protects the sizes of the vectors above, so that other threads
+     * can read or clear them.  Where \p std::atomic is available the
+     * thread only locks it when a vector has to grow, and the
+     * contents are kept consistent by \p sequence instead; otherwise
+     * it is locked for every event.  A thread which also needs the
+     * mutex of the \p PerfLog has to lock that one first.
+     */
+    pthread_mutex_t mutex;
+#endif
+
+#ifdef LIBMESH_HAVE_STD_THREAD
+    /**
+     * Odd while the thread is logging an event, and incremented
+     * twice for every event.
+     */
+    std::atomic<unsigned int> sequence;
+#endif
+
+  private:
+    // The mutex can't be copied
+    ThreadLog (const ThreadLog &);
+    ThreadLog & operator= (const ThreadLog &);
+  };
+
+  /**
+   * Returns the data for the calling thread, creating it on the
+   * first call from a new thread.
+   */
+  ThreadLog & thread_log ();
+
+  /**
+   * Looks up or creates the data for the calling thread.
+   */
+  ThreadLog & find_thread_log ();
+
+  /**
+   * Called when a thread which logged events exits.
+   */
+  static void release_thread_log (void *thread_log);
+
+  /**
+   * Pushes and pops \p event on the calling thread.
+   */
+  void push_event (EventId event);
+  void pop_event (EventId event);
+
+  /**
+   * Adds a trace record to \p tl.
+   */
+  void record_trace (ThreadLog &tl, uint64_t now, EventId event, bool begin);
+
+  /**
+   * Returns the event data summed over all threads, keyed by
+   * (header, label), with times converted to seconds.
+   */
+  std::map<std::pair<std::string, std::string>, PerfData> merged_log () const;
+
+  /**
+   * Returns the approximate length of a clock tick in seconds.  The
+   * clock is calibrated on the first call, which must not be made
+   * while holding \p mutex.
+   */
+  double seconds_per_tick () const;
 
   /**
    * The label for this object.
@@ -263,26 +668,69 @@ private:
   bool log_events;
 
   /**
-   * The total running time for recorded events.
+   * The time we were constructed or last cleared.
    */
-  double total_time;
+  struct timeval tstart;
 
   /**
-   * The time we were constructed or last cleared.
+   * The clock tick when we were constructed or last cleared.
    */
-  struct timeval tstart;
+  uint64_t tstart_ticks;
+
+  /**
+   * The length of a clock tick in seconds, or zero until the clock
+   * has been calibrated.
+   */
+  mutable double tick_seconds;
+
+  /**
+   * The number of records traced per thread, or zero if
+   * tracing is disabled.
+   */
+  std::size_t trace_capacity;
+
+  /**
+   * The open /proc/self/statm file, or -1 if memory logging is
+   * disabled.
+   */
+  int statm_fd;
+
+  /**
+   * The (header, label) of each registered event, indexed by
+   * \p EventId.
+   */
+  std::vector<std::pair<std::string, std::string> > event_names;
+
+  /**
+   * Maps (header, label) to the \p EventId of a registered event.
+   */
+  std::map<std::pair<std::string, std::string>, EventId> event_ids;
+
+  /**
+   * The data of every thread which has logged events.  The first
+   * entry belongs to the thread which constructed the log.
+   */
+  std::vector<ThreadLog*> thread_logs;
+
+  /**
+   * A number which is different for every \p PerfLog constructed,
+   * so that each thread can remember the last log it used and its
+   * data there without mistaking a new log for an old one.
+   */
+  unsigned long serial;
 
+#ifdef LIBMESH_HAVE_PTHREAD
   /**
-   * The actual log.
+   * Key to the \p ThreadLog of the calling thread.
    */
-  std::map<std::pair<std::string,
-                     std::string>,
-           PerfData> log;
+  pthread_key_t thread_key;
 
   /**
-   * A stack to hold the current performance log trace.
+   * Protects the registered events, \p thread_logs and
+   * \p tick_seconds.
    */
-  std::stack<PerfData*> log_stack;
+  mutable pthread_mutex_t mutex;
+#endif
 
   /**
    * Flag indicating if print_log() has been called.
@@ -291,6 +739,18 @@ private:
    */
   static bool called;
 
+  /**
+   * True once \p enable_allocation_counting() has been called.
+   */
+  static bool count_allocations;
+
+#ifdef LIBMESH_HAVE_STD_THREAD
+  /**
+   * The allocations counted on the calling thread so far.
+   */
+  static thread_local AllocationCounts allocation_counts;
+#endif
+
   /**
    * Splits a string on whitespace into a vector of separate strings.  This is used to make the
    * LIBMESH_CONFIGURE_INFO a little more manageable.
@@ -304,91 +764,83 @@ private:
 // ------------------------------------------------------------
 // PerfData class member funcions
 inline
-void PerfData::start ()
+void PerfData::start (uint64_t now)
 {
   this->count++;
   this->called_recursively++;
-  gettimeofday (&(this->tstart), NULL);
-  this->tstart_incl_sub = this->tstart;
+  this->tstart = now;
+  this->tstart_incl_sub = now;
 }
 
 
 
 inline
-void PerfData::restart ()
+void PerfData::restart (uint64_t now)
 {
-  gettimeofday (&(this->tstart), NULL);
+  this->tstart = now;
 }
 
 
 
 inline
-double PerfData::pause ()
+uint64_t PerfData::pause (uint64_t now)
 {
-  return this->stop_or_pause(false);
+  const uint64_t elapsed_ticks = now - this->tstart;
+
+  this->tot_ticks += elapsed_ticks;
+  this->tstart = now;
+
+  return elapsed_ticks;
 }
 
 
+
 inline
-double PerfData::stop_or_pause(const bool do_stop)
+uint64_t PerfData::stopit (uint64_t now)
 {
-  // save the start times, reuse the structure we have rather than create
-  // a new one.
-  const time_t
-    tstart_tv_sec  = this->tstart.tv_sec,
-    tstart_tv_usec = this->tstart.tv_usec;
-
-  gettimeofday (&(this->tstart), NULL);
-
-  const double elapsed_time = (static_cast<double>(this->tstart.tv_sec  - tstart_tv_sec) +
-                               static_cast<double>(this->tstart.tv_usec - tstart_tv_usec)*1.e-6);
+  // stopit is just similar to pause except that it decrements the
+  // recursive call counter and records the time including sub-events
 
-  this->tot_time += elapsed_time;
+  this->called_recursively--;
+  this->tot_ticks_incl_sub += now - this->tstart_incl_sub;
+  return this->pause(now);
+}
 
-  if(do_stop)
-    {
-      const double elapsed_time_incl_sub = (static_cast<double>(this->tstart.tv_sec  - this->tstart_incl_sub.tv_sec) +
-                                            static_cast<double>(this->tstart.tv_usec - this->tstart_incl_sub.tv_usec)*1.e-6);
 
-      this->tot_time_incl_sub += elapsed_time_incl_sub;
-    }
 
-  return elapsed_time;
+// ------------------------------------------------------------
+// PerfLog class inline member funcions
+inline
+uint64_t PerfLog::get_ticks ()
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  unsigned int lo, hi;
+  __asm__ __volatile__ ("rdtsc" : "=a" (lo), "=d" (hi));
+  return (static_cast<uint64_t>(hi) << 32) | lo;
+#else
+  struct timeval tnow;
+  gettimeofday (&tnow, NULL);
+  return static_cast<uint64_t>(tnow.tv_sec)*1000000 + tnow.tv_usec;
+#endif
 }
 
 
 
 inline
-double PerfData::stopit ()
+void PerfLog::push (EventId event)
 {
-  // stopit is just similar to pause except that it decrements the
-  // recursive call counter
-
-  this->called_recursively--;
-  return this->stop_or_pause(true);
+  if (this->log_events)
+    this->push_event(event);
 }
 
 
 
-// ------------------------------------------------------------
-// PerfLog class inline member funcions
 inline
 void PerfLog::push (const std::string &label,
                     const std::string &header)
 {
   if (this->log_events)
-    {
-      // Get a reference to the event data to avoid
-      // repeated map lookups
-      PerfData *perf_data = &(log[std::make_pair(header,label)]);
-
-      if (!log_stack.empty())
-        total_time +=
-          log_stack.top()->pause();
-
-      perf_data->start();
-      log_stack.push(perf_data);
-    }
+    this->push_event(this->register_event(label, header));
 }
 
 
@@ -398,52 +850,36 @@ void PerfLog::push (const char *label,
                     const char *header)
 {
   if (this->log_events)
-    this->push(std::string(label), std::string(header));
+    this->push_event(this->register_event(label, header));
 }
 
 
 
 inline
-void PerfLog::pop (const std::string &libmesh_dbg_var(label),
-                   const std::string &libmesh_dbg_var(header))
+void PerfLog::pop (EventId event)
 {
   if (this->log_events)
-    {
-      libmesh_assert (!log_stack.empty());
-
-#ifndef NDEBUG
-      PerfData *perf_data = &(log[std::make_pair(header,label)]);
-      if (perf_data != log_stack.top())
-        {
-          libMesh::err << "PerfLog can't pop (" << header << ',' << label << ')' << std::endl;
-          libMesh::err << "From top of stack of running logs:" << std::endl;
-          std::map<std::pair<std::string, std::string>, PerfData>::iterator
-            i = log.begin(), endi = log.end();
-          for (; i != endi; ++i)
-            if (&(i->second) == log_stack.top())
-              libMesh::err << '(' << i->first.first << ',' << i->first.second << ')' << std::endl;
-
-          libmesh_assert_equal_to (perf_data, log_stack.top());
-        }
-#endif
+    this->pop_event(event);
+}
 
-      total_time += log_stack.top()->stopit();
 
-      log_stack.pop();
 
-      if (!log_stack.empty())
-        log_stack.top()->restart();
-    }
+inline
+void PerfLog::pop (const std::string &label,
+                   const std::string &header)
+{
+  if (this->log_events)
+    this->pop_event(this->register_event(label, header));
 }
 
 
 
 inline
-void PerfLog::pop(const char *label,
-                  const char *header)
+void PerfLog::pop (const char *label,
+                   const char *header)
 {
   if (this->log_events)
-    this->pop(std::string(label), std::string(header));
+    this->pop_event(this->register_event(label, header));
 }
 
 
@@ -460,12 +896,6 @@ double PerfLog::get_elapsed_time () const
   return elapsed_time;
 }
 
-inline
-double PerfLog::get_active_time() const
-{
-  return total_time;
-}
-
 } // namespace libMesh
 
 
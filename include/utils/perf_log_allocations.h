@@ -0,0 +1,118 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2014 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_PERF_LOG_ALLOCATIONS_H
+#define LIBMESH_PERF_LOG_ALLOCATIONS_H
+
+// This header replaces the global operator new and operator delete
+// so that every PerfLog counts the allocations made by each event,
+// and reports them with the memory table printed at the end of the
+// run.  Include it in exactly one source file of an application, e.g.
+// the one holding main(); the library itself never includes it, so
+// applications which don't ask for the counts pay nothing for them.
+//
+// Each allocation costs an extra increment of two thread_local
+// counters.  Allocations are charged to the events of the thread
+// which makes them, so those made by the worker threads of a
+// Threads::parallel_for() do not show up in an event logged around
+// the loop on the calling thread.  Allocations made with the aligned
+// forms of operator new are not counted.
+
+// Local includes
+#include "libmesh/perf_log.h"
+
+// C++ includes
+#include <cstdlib>
+#include <new>
+
+#if __cplusplus > 199711L
+#  define LIBMESH_NEW_THROWS
+#  define LIBMESH_DELETE_THROWS noexcept
+#else
+#  define LIBMESH_NEW_THROWS throw(std::bad_alloc)
+#  define LIBMESH_DELETE_THROWS throw()
+#endif
+
+namespace
+{
+// Starts the counting before main() runs
+struct PerfLogAllocationCounter
+{
+  PerfLogAllocationCounter ()
+  { libMesh::PerfLog::enable_allocation_counting(); }
+} perf_log_allocation_counter;
+
+void * perf_log_allocate (std::size_t size)
+{
+  libMesh::PerfLog::count_allocation(size);
+
+  // malloc(0) may return NULL, but new has to return a unique pointer
+  void *ptr = std::malloc(size ? size : 1);
+  if (!ptr)
+    throw std::bad_alloc();
+  return ptr;
+}
+}
+
+void * operator new (std::size_t size) LIBMESH_NEW_THROWS
+{
+  return perf_log_allocate(size);
+}
+
+void * operator new[] (std::size_t size) LIBMESH_NEW_THROWS
+{
+  return perf_log_allocate(size);
+}
+
+void * operator new (std::size_t size, const std::nothrow_t &) LIBMESH_DELETE_THROWS
+{
+  libMesh::PerfLog::count_allocation(size);
+  return std::malloc(size ? size : 1);
+}
+
+void * operator new[] (std::size_t size, const std::nothrow_t &) LIBMESH_DELETE_THROWS
+{
+  libMesh::PerfLog::count_allocation(size);
+  return std::malloc(size ? size : 1);
+}
+
+void operator delete (void *ptr) LIBMESH_DELETE_THROWS
+{
+  std::free(ptr);
+}
+
+void operator delete[] (void *ptr) LIBMESH_DELETE_THROWS
+{
+  std::free(ptr);
+}
+
+void operator delete (void *ptr, const std::nothrow_t &) LIBMESH_DELETE_THROWS
+{
+  std::free(ptr);
+}
+
+void operator delete[] (void *ptr, const std::nothrow_t &) LIBMESH_DELETE_THROWS
+{
+  std::free(ptr);
+}
+
+#undef LIBMESH_NEW_THROWS
+#undef LIBMESH_DELETE_THROWS
+
+#endif // LIBMESH_PERF_LOG_ALLOCATIONS_H
@@ -19,6 +19,7 @@
 #define LIBMESH_POOL_ALLOCATOR_H
 
 #include "libmesh/libmesh_config.h"
+#include "libmesh/threads.h"
 
 #ifdef LIBMESH_HAVE_BOOST
 // See: http://stackoverflow.com/questions/17000542/boost-pool-can-i-wean-it-from-boost-system
@@ -29,7 +30,9 @@
 #  include <boost/pool/pool_alloc.hpp>
 #endif
 
+#include <cstddef> // std::size_t
 #include <memory> // std::allocator
+#include <new>    // ::operator new
 
 namespace libMesh
 {
@@ -218,6 +221,407 @@ public:
 
 #endif
 
+
+
+/**
+ * A slab allocator for the objects of a polymorphic class hierarchy,
+ * suitable for implementing class-specific \p operator \p new and
+ * \p operator \p delete.  Requests of up to \p MaxSize bytes are
+ * rounded up to a multiple of \p Granularity bytes and served from a
+ * free list per size class, which is refilled by carving up large
+ * slabs.  Allocating many objects of the same concrete type therefore
+ * costs a pointer pop rather than a call to \p malloc, and objects
+ * of one type end up packed contiguously in memory.  Larger requests
+ * are forwarded to the global \p operator \p new.
+ *
+ * Freed objects are put back on the free list of their size class
+ * and recycled by subsequent allocations.  Slabs are only returned to
+ * the system by \p release_memory(), and only for size classes with
+ * no live objects left.
+ *
+ * The pool has no constructor or destructor, so that a pool with
+ * static storage duration is zero-initialized before any code runs
+ * and remains usable during static destruction.  It does no locking
+ * of its own; \p ThreadedSlabPool shares one between threads.
+ */
+template <std::size_t MaxSize, std::size_t Granularity = 16>
+class SlabPool
+{
+public:
+
+  /**
+   * Returns a pointer to at least \p size bytes of storage.
+   */
+  void * allocate (std::size_t size)
+  {
+    if (size > MaxSize)
+      return ::operator new(size);
+
+    SizeClass & sc = _size_classes[size_class(size)];
+
+    if (!sc.free_list)
+      this->add_slab(sc, object_size(size));
+
+    FreeObject * obj = sc.free_list;
+    sc.free_list = obj->next;
+    ++sc.n_live;
+
+    return obj;
+  }
+
+  /**
+   * Returns the storage at \p ptr, which must have been obtained
+   * from \p allocate(size), to the pool.
+   */
+  void deallocate (void * ptr, std::size_t size)
+  {
+    if (!ptr)
+      return;
+
+    if (size > MaxSize)
+      {
+        ::operator delete(ptr);
+        return;
+      }
+
+    SizeClass & sc = _size_classes[size_class(size)];
+
+    FreeObject * obj = static_cast<FreeObject*>(ptr);
+    obj->next = sc.free_list;
+    sc.free_list = obj;
+    --sc.n_live;
+  }
+
+  /**
+   * Frees the slabs of every size class which has no live objects.
+   * Returns true if at least one slab was freed.
+   */
+  bool release_memory ()
+  {
+    bool freed_memory = false;
+
+    for (std::size_t i=0; i != n_size_classes; ++i)
+      {
+        SizeClass & sc = _size_classes[i];
+
+        if (sc.n_live || !sc.slabs)
+          continue;
+
+        while (sc.slabs)
+          {
+            Slab * next = sc.slabs->next;
+            ::operator delete(sc.slabs);
+            sc.slabs = next;
+          }
+
+        sc.free_list = NULL;
+        sc.slab_objects = 0;
+        freed_memory = true;
+      }
+
+    return freed_memory;
+  }
+
+  /**
+   * Returns the number of objects currently allocated from the pool,
+   * not counting those forwarded to the global \p operator \p new.
+   */
+  std::size_t n_objects () const
+  {
+    std::size_t n = 0;
+    for (std::size_t i=0; i != n_size_classes; ++i)
+      n += _size_classes[i].n_live;
+    return n;
+  }
+
+private:
+
+  /**
+   * Header overlaid on each free object to thread the free list.
+   */
+  struct FreeObject
+  {
+    FreeObject * next;
+  };
+
+  /**
+   * Header at the start of each slab; padded to \p Granularity bytes
+   * so the objects which follow it stay aligned.
+   */
+  union Slab
+  {
+    Slab * next;
+    char padding[Granularity];
+  };
+
+  struct SizeClass
+  {
+    FreeObject * free_list;
+    Slab * slabs;
+    std::size_t n_live;
+    std::size_t slab_objects;
+  };
+
+  static const std::size_t n_size_classes = (MaxSize + Granularity - 1) / Granularity + 1;
+
+  /**
+   * The number of objects in the first slab of each size class; each
+   * subsequent slab doubles in size, up to \p max_slab_objects.
+   */
+  static const std::size_t min_slab_objects = 64;
+  static const std::size_t max_slab_objects = 8192;
+
+  static std::size_t size_class (std::size_t size)
+  { return (size + Granularity - 1) / Granularity; }
+
+  static std::size_t object_size (std::size_t size)
+  {
+    const std::size_t rounded = size_class(size) * Granularity;
+    return (rounded < sizeof(FreeObject)) ? sizeof(FreeObject) : rounded;
+  }
+
+  void add_slab (SizeClass & sc, std::size_t obj_size)
+  {
+    if (!sc.slab_objects)
+      sc.slab_objects = min_slab_objects;
+    else if (sc.slab_objects < max_slab_objects)
+      sc.slab_objects *= 2;
+
+    Slab * slab = static_cast<Slab*>
+      (::operator new(sizeof(Slab) + sc.slab_objects*obj_size));
+    slab->next = sc.slabs;
+    sc.slabs = slab;
+
+    // Thread the new objects onto the (empty) free list, in address
+    // order so that consecutive allocations are contiguous.
+    char * first = reinterpret_cast<char*>(slab) + sizeof(Slab);
+    for (std::size_t i = sc.slab_objects; i != 0; --i)
+      {
+        FreeObject * obj = reinterpret_cast<FreeObject*>(first + (i-1)*obj_size);
+        obj->next = sc.free_list;
+        sc.free_list = obj;
+      }
+  }
+
+  SizeClass _size_classes[n_size_classes];
+};
+
+
+
+/**
+ * Shares a \p SlabPool between threads, for implementing the
+ * class-specific \p operator \p new and \p operator \p delete of
+ * the class hierarchy \p T.  Each thread keeps a short free list per
+ * size class, so most allocations and deallocations only touch that
+ * thread's memory, and the lock on the shared pool is only taken to
+ * move a batch of objects between the two.  Objects may be freed on
+ * a different thread than the one which allocated them.
+ *
+ * The shared pool and its lock are created on first use and never
+ * destroyed, so objects may still be freed during static destruction.
+ * A thread's free lists go back to the shared pool when the thread
+ * exits.  Objects cached by other threads still running count as
+ * live, so \p release_memory() cannot free their slabs.
+ *
+ * Without C++11 thread-local storage every call takes the lock.
+ */
+template <typename T, std::size_t MaxSize, std::size_t Granularity = 16>
+class ThreadedSlabPool
+{
+public:
+
+  /**
+   * Returns a pointer to at least \p size bytes of storage.
+   */
+  static void * allocate (std::size_t size)
+  {
+#ifdef LIBMESH_HAVE_STD_THREAD
+    ThreadCache & cache = thread_cache();
+
+    if (size <= MaxSize && cache.active)
+      {
+        const std::size_t c = size_class(size);
+        FreeList & list = cache.lists[c];
+
+        if (!list.head)
+          {
+            Shared & shared = get_shared();
+            Threads::spin_mutex::scoped_lock lock(shared.mutex);
+            for (std::size_t i=0; i != batch_objects; ++i)
+              list.push(static_cast<FreeObject*>(shared.pool.allocate(c*Granularity)));
+          }
+
+        return list.pop();
+      }
+#endif
+
+    Shared & shared = get_shared();
+    Threads::spin_mutex::scoped_lock lock(shared.mutex);
+    return shared.pool.allocate(size);
+  }
+
+  /**
+   * Returns the storage at \p ptr, which must have been obtained
+   * from \p allocate(size), to the pool.
+   */
+  static void deallocate (void * ptr, std::size_t size)
+  {
+    if (!ptr)
+      return;
+
+#ifdef LIBMESH_HAVE_STD_THREAD
+    ThreadCache & cache = thread_cache();
+
+    if (size <= MaxSize && cache.active)
+      {
+        const std::size_t c = size_class(size);
+        FreeList & list = cache.lists[c];
+
+        // Make room before pushing, so that the object freed last is
+        // the first one handed out again
+        if (list.n == 2*batch_objects)
+          return_objects(list, c, batch_objects);
+
+        list.push(static_cast<FreeObject*>(ptr));
+        return;
+      }
+#endif
+
+    Shared & shared = get_shared();
+    Threads::spin_mutex::scoped_lock lock(shared.mutex);
+    shared.pool.deallocate(ptr, size);
+  }
+
+  /**
+   * Returns the calling thread's free lists to the shared pool, then
+   * frees the slabs of every size class which has no live objects.
+   * Returns true if at least one slab was freed.
+   */
+  static bool release_memory ()
+  {
+#ifdef LIBMESH_HAVE_STD_THREAD
+    flush(thread_cache());
+#endif
+
+    Shared & shared = get_shared();
+    Threads::spin_mutex::scoped_lock lock(shared.mutex);
+    return shared.pool.release_memory();
+  }
+
+private:
+
+  typedef SlabPool<MaxSize, Granularity> Pool;
+
+  static const std::size_t n_size_classes = (MaxSize + Granularity - 1) / Granularity + 1;
+
+  /**
+   * The number of objects moved between a thread's free list and the
+   * shared pool at once.  A free list holds at most twice as many.
+   */
+  static const std::size_t batch_objects = 32;
+
+  static std::size_t size_class (std::size_t size)
+  { return (size + Granularity - 1) / Granularity; }
+
+  struct FreeObject
+  {
+    FreeObject * next;
+  };
+
+  struct FreeList
+  {
+    FreeObject * head;
+    std::size_t n;
+
+    void push (FreeObject * obj)
+    {
+      obj->next = head;
+      head = obj;
+      ++n;
+    }
+
+    FreeObject * pop ()
+    {
+      FreeObject * obj = head;
+      head = obj->next;
+      --n;
+      return obj;
+    }
+  };
+
+  struct Shared
+  {
+    Pool pool;
+    Threads::spin_mutex mutex;
+  };
+
+  /**
+   * The pool shared by all threads.
+   */
+  static Shared & get_shared ()
+  {
+    // Value-initialization zeroes the pool.  It is deliberately never
+    // destroyed.
+    static Shared * shared = new Shared();
+    return *shared;
+  }
+
+  /**
+   * Moves \p n objects of size class \p c from \p list to the
+   * shared pool.
+   */
+  static void return_objects (FreeList & list,
+                              const std::size_t c,
+                              const std::size_t n)
+  {
+    Shared & shared = get_shared();
+    Threads::spin_mutex::scoped_lock lock(shared.mutex);
+    for (std::size_t i=0; i != n; ++i)
+      shared.pool.deallocate(list.pop(), c*Granularity);
+  }
+
+#ifdef LIBMESH_HAVE_STD_THREAD
+  /**
+   * The free lists of one thread.  This is plain data, so it is
+   * zero-initialized without any code running; \p active is only set
+   * while a \p ThreadCacheOwner will return the lists at thread exit.
+   */
+  struct ThreadCache
+  {
+    bool active;
+    FreeList lists[n_size_classes];
+  };
+
+  struct ThreadCacheOwner
+  {
+    explicit ThreadCacheOwner (ThreadCache & cache) : _cache(cache)
+    { _cache.active = true; }
+
+    ~ThreadCacheOwner ()
+    {
+      flush(_cache);
+      _cache.active = false;
+    }
+
+    ThreadCache & _cache;
+  };
+
+  static ThreadCache & thread_cache ()
+  {
+    static thread_local ThreadCache cache;
+    static thread_local ThreadCacheOwner owner(cache);
+    return cache;
+  }
+
+  static void flush (ThreadCache & cache)
+  {
+    for (std::size_t c=0; c != n_size_classes; ++c)
+      if (cache.lists[c].n)
+        return_objects(cache.lists[c], c, cache.lists[c].n);
+  }
+#endif
+};
+
 } // end namespace libMesh
 
 
@@ -0,0 +1,180 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2014 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_TEXT_FILE_BUFFER_H
+#define LIBMESH_TEXT_FILE_BUFFER_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <string>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * Read-only access to the contents of a text file.  The file is
+ * memory-mapped where the platform supports it, so that only the
+ * pages which are actually parsed are ever read from disk; otherwise
+ * it is read into memory.  Use a TextParser to parse the contents.
+ */
+class TextFileBuffer
+{
+public:
+
+  /**
+   * Opens the file \p name, which must exist.
+   */
+  explicit
+  TextFileBuffer (const std::string& name);
+
+  /**
+   * Destructor.  Unmaps or frees the contents.
+   */
+  ~TextFileBuffer ();
+
+  /**
+   * Returns a pointer to the first character of the file.
+   */
+  const char* begin () const { return _begin; }
+
+  /**
+   * Returns a pointer past the last character of the file.
+   */
+  const char* end () const { return _begin + _size; }
+
+  /**
+   * Returns the size of the file in bytes.
+   */
+  std::size_t size () const { return _size; }
+
+  /**
+   * Returns true if the file is memory-mapped rather than held in
+   * memory.
+   */
+  bool is_mapped () const { return _mapped; }
+
+private:
+
+  /**
+   * Copying would require mapping the file again.
+   */
+  TextFileBuffer (const TextFileBuffer&);
+  TextFileBuffer& operator= (const TextFileBuffer&);
+
+  const char* _begin;
+  std::size_t _size;
+  bool _mapped;
+
+  /**
+   * The contents of the file, if it could not be mapped.
+   */
+  std::vector<char> _data;
+};
+
+
+
+/**
+ * A cursor for parsing whitespace-separated ASCII data in the range
+ * [begin, end), such as a TextFileBuffer or a part of it.  Numbers
+ * are parsed directly from the characters without going through an
+ * iostream; Fortran-style "D" exponents are accepted in real numbers.
+ */
+class TextParser
+{
+public:
+
+  /**
+   * Constructor.  Parses the characters in [begin, end).
+   */
+  TextParser (const char* begin, const char* end) :
+    _pos(begin),
+    _end(end)
+  {}
+
+  /**
+   * Returns the current position.
+   */
+  const char* position () const { return _pos; }
+
+  /**
+   * Returns true if there are no more characters to parse.
+   */
+  bool at_end () const { return _pos == _end; }
+
+  /**
+   * Skips any whitespace, including line breaks, and returns true if
+   * there are characters left to parse.
+   */
+  bool skip_whitespace ();
+
+  /**
+   * Advances to the beginning of the next line.
+   */
+  void skip_line ();
+
+  /**
+   * Sets [\p begin, \p end) to the rest of the current line, without
+   * leading and trailing whitespace, and advances to the beginning of
+   * the next line.  Returns false if there are no more characters to
+   * parse.
+   */
+  bool read_line (const char*& begin, const char*& end);
+
+  /**
+   * Returns the next whitespace-separated token.
+   */
+  std::string read_token ();
+
+  /**
+   * Returns true if the current line, ignoring leading whitespace,
+   * starts with \p token.  Does not advance.
+   */
+  bool line_starts_with (const char* token) const;
+
+  /**
+   * Parses and returns the next integer.
+   */
+  long read_int ();
+
+  /**
+   * Parses and returns the next real number.
+   */
+  Real read_real ();
+
+  /**
+   * Returns the first position in [begin, end) which starts a line,
+   * or \p end if there is none.  \p file_begin is the beginning of
+   * the data \p begin points into.
+   */
+  static const char* line_start_at_or_after (const char* file_begin,
+                                             const char* begin,
+                                             const char* end);
+
+private:
+
+  const char* _pos;
+  const char* const _end;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_TEXT_FILE_BUFFER_H
@@ -28,6 +28,7 @@
 // C++ Includes   -----------------------------------
 #include LIBMESH_INCLUDE_UNORDERED_MAP
 #include LIBMESH_INCLUDE_HASH
+#include <algorithm>
 #include <vector>
 
 namespace libMesh
@@ -62,6 +63,11 @@ public:
  *
  * For efficiency we will use a hashed map if it is available,
  * otherwise a regular map.
+ *
+ * The map is split by key into one shard per thread, so that it can
+ * be filled on all threads at once: nodes may be added from several
+ * threads concurrently as long as each thread adds only the pairs
+ * belonging to shards no other thread is adding to.
  */
 class TopologyMap
 {
@@ -75,9 +81,15 @@ class TopologyMap
   typedef LIBMESH_BEST_UNORDERED_MAP<std::pair<dof_id_type, dof_id_type>,
                                      dof_id_type MYHASH> map_type;
 public:
+  TopologyMap() : _maps(1) {}
+
+  /**
+   * Fills the map with the nodes of the children of every element of
+   * the mesh, using one shard for each thread.
+   */
   void init(MeshBase&);
 
-  void clear() { _map.clear(); }
+  void clear();
 
   /**
    * Add a node to the map, between each pair of specified bracketing
@@ -88,7 +100,34 @@ public:
                 std::pair<dof_id_type, dof_id_type> >&
                 bracketing_nodes);
 
-  bool empty() const { return _map.empty(); }
+  /**
+   * Add a node to the map between those pairs of the specified
+   * bracketing nodes which belong in shard \p s, and no others.
+   */
+  void add_node(const Node& mid_node,
+                const std::vector<
+                std::pair<dof_id_type, dof_id_type> >&
+                bracketing_nodes,
+                unsigned int s);
+
+  bool empty() const;
+
+  /**
+   * The number of shards the map is split into.
+   */
+  unsigned int n_shards() const
+  { return libmesh_cast_int<unsigned int>(_maps.size()); }
+
+  /**
+   * The shard which holds the pair of nodes \p id1, \p id2.
+   */
+  unsigned int shard(dof_id_type id1,
+                     dof_id_type id2) const
+  {
+    return libmesh_cast_int<unsigned int>
+      (myhash()(std::make_pair(std::min(id1, id2), std::max(id1, id2))) %
+       _maps.size());
+  }
 
   dof_id_type find(dof_id_type bracket_node1,
                    dof_id_type bracket_node2) const;
@@ -101,7 +140,20 @@ protected:
   void fill(const MeshBase&);
 
 private:
-  map_type          _map;
+  /**
+   * Functor which adds the nodes gathered by fill() to the shards of
+   * the map concurrently.  Defined in topology_map.C.
+   */
+  class FillShards;
+
+  /**
+   * Add a node to the map, between the nodes \p id1 and \p id2.
+   */
+  void add_bracketed_node(dof_id_type mid_node_id,
+                          dof_id_type id1,
+                          dof_id_type id2);
+
+  std::vector<map_type> _maps;
 };
 
 } // namespace libMesh
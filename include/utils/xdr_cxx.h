@@ -65,6 +65,18 @@ namespace libMesh
  * creating platform-independent binary files.  This class was
  * created to handle equation system output as a replacement for
  * XdrIO since that is somewhat limited.
+ *
+ * In the ASCII (READ/WRITE) modes, files whose names end in .gz,
+ * .bz2 or .xz are compressed, without an uncompressed temporary
+ * file.  .gz files are handled in-process by gzstream, and .bz2 and
+ * .xz files by libbz2 and liblzma when libMesh is built with them;
+ * otherwise they are streamed through a bzip2 or xz pipe.
+ *
+ * Binary files opened for DECODE are also memory-mapped when the
+ * platform allows it.  The XDR encoding is fixed-width and big-endian,
+ * so \p data_stream() can then decode whole arrays straight from the
+ * mapping, and \p data_stream_at() lets any processor decode values
+ * at a known byte offset without reading the rest of the file.
  */
 
 class Xdr
@@ -117,6 +129,12 @@ public:
    */
   XdrMODE access_mode () const { return mode; }
 
+  /**
+   * Returns the name of the open file, or an empty string if no
+   * file is open.
+   */
+  const std::string& name () const { return file_name; }
+
   // Data access methods
 
   /**
@@ -148,6 +166,51 @@ public:
    */
   void comment (std::string &);
 
+  /**
+   * Returns true if this is a binary file opened for reading through
+   * a memory mapping, in which case \p data_stream_at() may be used.
+   */
+  bool is_mapped() const;
+
+  /**
+   * Returns the current byte offset in a binary (ENCODE/DECODE) file.
+   */
+  std::size_t position() const;
+
+  /**
+   * Moves to byte offset \p pos in a binary file opened for reading.
+   */
+  void seek (const std::size_t pos);
+
+  /**
+   * Decodes \p len values starting at byte offset \p pos of a
+   * memory-mapped file into \p val.  Only the pages holding those
+   * values are read from disk, and the current position is unchanged.
+   */
+  template <typename T>
+  void data_stream_at (const std::size_t pos, T *val, const unsigned int len) const;
+
+  /**
+   * Returns the number of bytes used to encode a value of type \p T
+   * in a binary file.
+   */
+  template <typename T>
+  static std::size_t encoded_size ();
+
+  /**
+   * Sets the compression level of .bz2 and .xz files opened for
+   * WRITE after this call, from 1 (fastest) to 9 (smallest).  A
+   * negative level, the default, uses each format's own default:
+   * 9 for bzip2 and 6 for xz.  With libbz2 and liblzma, files are
+   * compressed with as many threads as libMesh was started with.
+   */
+  void set_compression_level (int level) { compression_level = level; }
+
+  /**
+   * Returns the compression level set by \p set_compression_level().
+   */
+  int get_compression_level () const { return compression_level; }
+
   /**
    * Sets the version of the file that is being read
    */
@@ -215,6 +278,17 @@ private:
    */
   FILE* fp;
 
+  /**
+   * Read-only mapping of a file opened for DECODE, or NULL if the
+   * file could not be mapped.
+   */
+  char* mapped_data;
+
+  /**
+   * Size of the mapping.
+   */
+  std::size_t mapped_size;
+
 #endif
 
   /**
@@ -238,6 +312,12 @@ private:
    */
   bool gzipped_file, bzipped_file, xzipped_file;
 
+  /**
+   * The compression level for .bz2 and .xz files, or negative for
+   * the default.
+   */
+  int compression_level;
+
   /**
    * Version of the file being read
    */
@@ -262,6 +262,15 @@ AC_ARG_ENABLE(bzip2,
               enablebz2=$enableoptional)
 
 if (test "$enablebz2" != no) ; then
+   AC_CHECK_HEADER(bzlib.h, [have_bzlib_h=yes], [have_bzlib_h=no])
+   AC_CHECK_LIB(bz2, BZ2_bzReadOpen, [have_libbz2=yes], [have_libbz2=no])
+   if (test "$have_bzlib_h" = yes -a "$have_libbz2" = yes) ; then
+     AC_MSG_RESULT(<<< Using libbz2 for writing/reading compressed .bz2 files >>>)
+     AC_DEFINE(HAVE_LIBBZ2, 1,
+               [Flag indicating libbz2 is available for handling compressed .bz2 files])
+     libmesh_optional_LIBS="-lbz2 $libmesh_optional_LIBS"
+   fi
+
    #           Var   | look for | name if found | name if not | where
    AC_CHECK_PROG(BZIP2,  bzip2,      bzip2,           none,      $PATH)
    if test "$BZIP2" = bzip2; then
@@ -286,6 +295,15 @@ AC_ARG_ENABLE(xz,
               enablexz=$enableoptional)
 
 if (test "$enablexz" != no) ; then
+   AC_CHECK_HEADER(lzma.h, [have_lzma_h=yes], [have_lzma_h=no])
+   AC_CHECK_LIB(lzma, lzma_stream_decoder, [have_liblzma=yes], [have_liblzma=no])
+   if (test "$have_lzma_h" = yes -a "$have_liblzma" = yes) ; then
+     AC_MSG_RESULT(<<< Using liblzma for writing/reading compressed .xz files >>>)
+     AC_DEFINE(HAVE_LIBLZMA, 1,
+               [Flag indicating liblzma is available for handling compressed .xz files])
+     libmesh_optional_LIBS="-llzma $libmesh_optional_LIBS"
+   fi
+
    #           Var   | look for | name if found | name if not | where
    AC_CHECK_PROG(XZ,  xz,      xz,           none,      $PATH)
    if test "$XZ" = xz; then